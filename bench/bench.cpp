@@ -0,0 +1,258 @@
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// the size which stands for a dynamic-size Matrix
+constexpr std::size_t DYNAMIC = std::numeric_limits<std::size_t>::max();
+
+// square Matrix of N * N cells, or of dynamic size
+template <typename T, std::size_t N>
+using Square = Matrix<T, N, N>;
+
+// sizes that dynamic-size matrices are benchmarked at, by powers of two
+constexpr std::int64_t SMALLEST_SIZE = 2;
+constexpr std::int64_t LARGEST_SIZE = 4096;
+
+// sizes that fixed-size matrices are benchmarked at, which are kept small
+// enough to store their cells on the stack
+using FixedSizes = std::integer_sequence<std::size_t, 2, 4, 8, 16, 32, 64>;
+
+template <typename T>
+constexpr const char* TYPE_NAME = "";
+template <>
+constexpr const char* TYPE_NAME<int> = "int";
+template <>
+constexpr const char* TYPE_NAME<float> = "float";
+template <>
+constexpr const char* TYPE_NAME<double> = "double";
+
+// the size of the matrices a benchmark runs with
+template <std::size_t N>
+std::size_t size_of(const benchmark::State& state) {
+    return N == DYNAMIC ? static_cast<std::size_t>(state.range(0)) : N;
+}
+
+// square Matrix of size n, all zero
+template <typename T, std::size_t N>
+Square<T, N> make_zero(std::size_t n) {
+    if constexpr (N == DYNAMIC) {
+        return Square<T, N>(n, n);
+    } else {
+        return Square<T, N>();
+    }
+}
+
+// square Matrix of size n with a predictable, non-uniform pattern of small
+// contents, so that no operation on it overflows any element type
+template <typename T, std::size_t N>
+Square<T, N> make_patterned(std::size_t n) {
+    Square<T, N> matrix = make_zero<T, N>(n);
+    auto cells = matrix.contents();
+    for (std::size_t i = 0; i < cells.size(); i++) {
+        cells[i] = static_cast<T>(static_cast<int>(i % 7) - 3);
+    }
+    return matrix;
+}
+
+// unit upper-triangular Matrix of size n, whose determinant is one, so that
+// every value in its elimination fits any element type
+template <typename T, std::size_t N>
+Square<T, N> make_triangular(std::size_t n) {
+    Square<T, N> matrix = make_zero<T, N>(n);
+    for (std::size_t m = 0; m < n; m++) {
+        matrix(m, m) = T{1};
+        for (std::size_t k = m + 1; k < n; k++) {
+            matrix(m, k) = static_cast<T>(static_cast<int>((m + k) % 5) - 2);
+        }
+    }
+    return matrix;
+}
+
+// reports the floating-point (or integer) operations and the bytes of cells
+// read and written by each iteration, as rates
+void report(benchmark::State& state, double operations, double bytes) {
+    if (operations != 0) {
+        state.counters["FLOP/s"] = benchmark::Counter(operations, benchmark::Counter::kIsIterationInvariantRate);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes) * state.iterations());
+}
+
+struct Construction {
+    static constexpr const char* NAME = "construction";
+    template <typename T, std::size_t N>
+    static void run(benchmark::State& state) {
+        const std::size_t n = size_of<N>(state);
+        for (auto _ : state) {
+            Square<T, N> matrix = make_zero<T, N>(n);
+            benchmark::DoNotOptimize(matrix.contents().data());
+            benchmark::ClobberMemory();
+        }
+        report(state, 0, static_cast<double>(n * n * sizeof(T)));
+    }
+};
+
+struct CellAccess {
+    static constexpr const char* NAME = "cell_access";
+    template <typename T, std::size_t N>
+    static void run(benchmark::State& state) {
+        const std::size_t n = size_of<N>(state);
+        const Square<T, N> matrix = make_patterned<T, N>(n);
+        for (auto _ : state) {
+            T sum{};
+            for (std::size_t m = 0; m < n; m++) {
+                for (std::size_t k = 0; k < n; k++) {
+                    sum += matrix(m, k);
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        report(state, 0, static_cast<double>(n * n * sizeof(T)));
+    }
+};
+
+struct Addition {
+    static constexpr const char* NAME = "addition";
+    template <typename T, std::size_t N>
+    static void run(benchmark::State& state) {
+        const std::size_t n = size_of<N>(state);
+        const Square<T, N> a = make_patterned<T, N>(n);
+        const Square<T, N> b = make_patterned<T, N>(n);
+        for (auto _ : state) {
+            Square<T, N> sum(a + b);
+            benchmark::DoNotOptimize(sum.contents().data());
+            benchmark::ClobberMemory();
+        }
+        report(state, static_cast<double>(n * n), static_cast<double>(3 * n * n * sizeof(T)));
+    }
+};
+
+struct Multiplication {
+    static constexpr const char* NAME = "multiplication";
+    template <typename T, std::size_t N>
+    static void run(benchmark::State& state) {
+        const std::size_t n = size_of<N>(state);
+        const Square<T, N> a = make_patterned<T, N>(n);
+        const Square<T, N> b = make_patterned<T, N>(n);
+        for (auto _ : state) {
+            auto product = a * b;
+            benchmark::DoNotOptimize(product.contents().data());
+            benchmark::ClobberMemory();
+        }
+        report(state, 2.0 * static_cast<double>(n * n * n), static_cast<double>(3 * n * n * sizeof(T)));
+    }
+};
+
+struct Transpose {
+    static constexpr const char* NAME = "transpose";
+    template <typename T, std::size_t N>
+    static void run(benchmark::State& state) {
+        const std::size_t n = size_of<N>(state);
+        const Square<T, N> matrix = make_patterned<T, N>(n);
+        for (auto _ : state) {
+            auto transpose = matrix.transpose();
+            benchmark::DoNotOptimize(transpose.contents().data());
+            benchmark::ClobberMemory();
+        }
+        report(state, 0, static_cast<double>(2 * n * n * sizeof(T)));
+    }
+};
+
+struct Submatrix {
+    static constexpr const char* NAME = "submatrix";
+    template <typename T, std::size_t N>
+    static void run(benchmark::State& state) {
+        const std::size_t n = size_of<N>(state);
+        const Square<T, N> matrix = make_patterned<T, N>(n);
+        for (auto _ : state) {
+            auto submatrix = matrix.submatrix(n / 2, n / 2);
+            benchmark::DoNotOptimize(submatrix.contents().data());
+            benchmark::ClobberMemory();
+        }
+        report(state, 0, static_cast<double>(2 * (n - 1) * (n - 1) * sizeof(T)));
+    }
+};
+
+struct Determinant {
+    static constexpr const char* NAME = "determinant";
+    template <typename T, std::size_t N>
+    static void run(benchmark::State& state) {
+        const std::size_t n = size_of<N>(state);
+        const Square<T, N> matrix = make_triangular<T, N>(n);
+        for (auto _ : state) {
+            T determinant = matrix.determinant();
+            benchmark::DoNotOptimize(determinant);
+        }
+        // elimination takes about 2n^3 / 3 operations
+        report(state, 2.0 * static_cast<double>(n * n * n) / 3.0, static_cast<double>(n * n * sizeof(T)));
+    }
+};
+
+struct Equality {
+    static constexpr const char* NAME = "equality";
+    template <typename T, std::size_t N>
+    static void run(benchmark::State& state) {
+        const std::size_t n = size_of<N>(state);
+        // equal matrices, so that every cell is compared
+        const Square<T, N> a = make_patterned<T, N>(n);
+        const Square<T, N> b = a;
+        for (auto _ : state) {
+            bool equal = a == b;
+            benchmark::DoNotOptimize(equal);
+        }
+        report(state, 0, static_cast<double>(2 * n * n * sizeof(T)));
+    }
+};
+
+// registers an operation for element type T, over all the sizes of dynamic
+// and fixed-size matrices, named "operation/type/dynamic/size" and
+// "operation/type/fixed/size"
+template <typename Operation, typename T, std::size_t... N>
+void register_operation(std::integer_sequence<std::size_t, N...>) {
+    const std::string name = std::string(Operation::NAME) + "/" + TYPE_NAME<T>;
+    benchmark::RegisterBenchmark((name + "/dynamic").c_str(), Operation::template run<T, DYNAMIC>)
+        ->RangeMultiplier(2)
+        ->Range(SMALLEST_SIZE, LARGEST_SIZE);
+    (
+        benchmark::RegisterBenchmark((name + "/fixed").c_str(), Operation::template run<T, N>)
+            ->Arg(static_cast<std::int64_t>(N)),
+        ...
+    );
+}
+
+template <typename... Operations>
+void register_operations() {
+    (register_operation<Operations, int>(FixedSizes{}), ...);
+    (register_operation<Operations, float>(FixedSizes{}), ...);
+    (register_operation<Operations, double>(FixedSizes{}), ...);
+}
+
+// runs the benchmarks given on the command line (all of them by default),
+// reporting in JSON unless another format is asked for
+int main(int argc, char** argv) {
+    register_operations<
+        Construction, CellAccess, Addition, Multiplication, Transpose, Submatrix, Determinant, Equality
+    >();
+    // later arguments override earlier ones
+    char json[] = "--benchmark_format=json";
+    std::vector<char*> arguments(argv, argv + argc);
+    arguments.insert(arguments.begin() + 1, json);
+    int count = static_cast<int>(arguments.size());
+    arguments.push_back(nullptr);
+    benchmark::Initialize(&count, arguments.data());
+    if (benchmark::ReportUnrecognizedArguments(count, arguments.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
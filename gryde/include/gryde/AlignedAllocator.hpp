@@ -0,0 +1,54 @@
+#ifndef COM_SAXBOPHONE_GRYDE_ALIGNED_ALLOCATOR_HPP
+#define COM_SAXBOPHONE_GRYDE_ALIGNED_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <limits>
+#include <new>
+
+#include <cstddef>
+
+namespace com::saxbophone::gryde {
+// size of a cache line on the CPUs we care about, which is also the width of
+// the widest vectors used by the element-wise kernels
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+// allocator which aligns storage to at least ALIGNMENT bytes, this is the
+// default for the cells of dynamic-size Matrix so that they start on a cache
+// line boundary
+template <typename T, std::size_t ALIGNMENT = CACHE_LINE_SIZE>
+class AlignedAllocator {
+    static_assert(
+        ALIGNMENT != 0 and (ALIGNMENT & (ALIGNMENT - 1)) == 0,
+        "Alignment must be a power of two"
+    );
+public:
+    using value_type = T;
+    // the alignment actually used, never less than T needs
+    static constexpr std::size_t ALIGNMENT_BYTES = std::max(ALIGNMENT, alignof(T));
+    // allocator_traits can't rebind allocators with non-type template parameters
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, ALIGNMENT>;
+    };
+    constexpr AlignedAllocator() noexcept = default;
+    template <typename U>
+    constexpr AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) noexcept {}
+    [[nodiscard]] T* allocate(std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(
+            ::operator new(n * sizeof(T), std::align_val_t{ALIGNMENT_BYTES})
+        );
+    }
+    void deallocate(T* p, std::size_t n) noexcept {
+        ::operator delete(p, n * sizeof(T), std::align_val_t{ALIGNMENT_BYTES});
+    }
+    // stateless, so all instances can free each other's storage
+    template <typename U>
+    constexpr bool operator==(const AlignedAllocator<U, ALIGNMENT>&) const noexcept {
+        return true;
+    }
+};
+} // namespace com::saxbophone::gryde
+#endif // include guard
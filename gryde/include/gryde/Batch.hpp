@@ -0,0 +1,217 @@
+#ifndef COM_SAXBOPHONE_GRYDE_BATCH_HPP
+#define COM_SAXBOPHONE_GRYDE_BATCH_HPP
+
+#include <concepts>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+#include <gryde/Execution.hpp>
+#include <gryde/Layout.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/ThreadPool.hpp>
+#include <gryde/detail/Batch.hpp>
+#include <gryde/detail/Simd.hpp>
+
+namespace com::saxbophone::gryde {
+namespace detail {
+    // dimensions and layout of fixed-size Matrix types
+    template <typename X>
+    struct FixedMatrixTraits {
+        static constexpr bool IS_FIXED = false;
+    };
+
+    template <typename T, std::size_t M, std::size_t N, typename A, Layout L>
+    requires (M != DYNAMIC_EXTENT and N != DYNAMIC_EXTENT)
+    struct FixedMatrixTraits<Matrix<T, M, N, A, L>> {
+        static constexpr bool IS_FIXED = true;
+        static constexpr std::size_t ROWS = M;
+        static constexpr std::size_t COLS = N;
+        static constexpr Layout LAYOUT = L;
+    };
+
+    // contiguous sequence of fixed-size matrices, such as a std::span or std::vector
+    template <typename R>
+    concept FixedMatrixRange = std::ranges::contiguous_range<R> and std::ranges::sized_range<R> and
+        FixedMatrixTraits<std::ranges::range_value_t<R>>::IS_FIXED;
+
+    // contiguous sequence of scalars of type T
+    template <typename R, typename T>
+    concept ScalarRange = std::ranges::contiguous_range<R> and std::ranges::sized_range<R> and
+        std::same_as<std::ranges::range_value_t<R>, T>;
+
+    template <typename R>
+    using batch_matrix_t = std::ranges::range_value_t<R>;
+
+    inline void check_batch_sizes(std::size_t input, std::size_t output) {
+        if (input != output) {
+            throw std::runtime_error("Batch sizes don't match");
+        }
+    }
+
+    // applies OP to the batch at a (and b), spreading it across pool if not null
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename A, typename B, typename C>
+    void batch_apply(ThreadPool* pool, const A* a, const B* b, C* out, std::size_t count) {
+        const simd::Isa isa = simd::active_isa();
+        batch_for(pool, count, [&](std::size_t begin, std::size_t end) {
+            batch<OP, M, N, P>(
+                isa, a + begin, OP == BatchOperation::MULTIPLY ? b + begin : b, out + begin, end - begin
+            );
+        });
+    }
+
+    template <FixedMatrixRange L, FixedMatrixRange R, FixedMatrixRange O>
+    void batch_multiply(ThreadPool* pool, const L& lhs, const R& rhs, O& output) {
+        using X = batch_matrix_t<L>;
+        using Y = batch_matrix_t<R>;
+        using Z = batch_matrix_t<O>;
+        constexpr std::size_t M = FixedMatrixTraits<X>::ROWS;
+        constexpr std::size_t N = FixedMatrixTraits<X>::COLS;
+        constexpr std::size_t P = FixedMatrixTraits<Y>::COLS;
+        static_assert(
+            std::is_same_v<typename X::value_type, typename Y::value_type> and
+            std::is_same_v<typename X::value_type, typename Z::value_type>,
+            "Matrix element types don't match"
+        );
+        static_assert(
+            FixedMatrixTraits<Y>::ROWS == N,
+            "Matrix dimensions are incompatible for multiplication"
+        );
+        static_assert(
+            FixedMatrixTraits<Z>::ROWS == M and FixedMatrixTraits<Z>::COLS == P,
+            "Output Matrix dimensions don't match"
+        );
+        static_assert(
+            FixedMatrixTraits<X>::LAYOUT == FixedMatrixTraits<Y>::LAYOUT and
+            FixedMatrixTraits<X>::LAYOUT == FixedMatrixTraits<Z>::LAYOUT,
+            "Matrix layouts don't match"
+        );
+        check_batch_sizes(std::ranges::size(lhs), std::ranges::size(rhs));
+        check_batch_sizes(std::ranges::size(lhs), std::ranges::size(output));
+        batch_apply<BatchOperation::MULTIPLY, M, N, P>(
+            pool, std::ranges::data(lhs), std::ranges::data(rhs), std::ranges::data(output),
+            std::ranges::size(lhs)
+        );
+    }
+
+    // the kernels read the cells of a column-major Matrix as its transpose,
+    // which has the same determinant, and whose inverse is the transpose of
+    // the inverse, so they work on matrices of either layout
+    template <FixedMatrixRange I, typename O>
+    void batch_determinant(ThreadPool* pool, const I& input, O& output) {
+        using X = batch_matrix_t<I>;
+        constexpr std::size_t M = FixedMatrixTraits<X>::ROWS;
+        static_assert(
+            M == FixedMatrixTraits<X>::COLS,
+            "Determinant is undefined for non-square Matrix"
+        );
+        check_batch_sizes(std::ranges::size(input), std::ranges::size(output));
+        batch_apply<BatchOperation::DETERMINANT, M, M, M>(
+            pool, std::ranges::data(input), static_cast<const X*>(nullptr), std::ranges::data(output),
+            std::ranges::size(input)
+        );
+    }
+
+    template <FixedMatrixRange I, FixedMatrixRange O>
+    void batch_inverse(ThreadPool* pool, const I& input, O& output) {
+        using X = batch_matrix_t<I>;
+        constexpr std::size_t M = FixedMatrixTraits<X>::ROWS;
+        static_assert(
+            std::is_floating_point_v<typename X::value_type>,
+            "Inverse is only implemented for floating-point Matrix"
+        );
+        static_assert(
+            M == FixedMatrixTraits<X>::COLS,
+            "Inverse is undefined for non-square Matrix"
+        );
+        static_assert(std::is_same_v<batch_matrix_t<O>, X>, "Output Matrix type doesn't match");
+        check_batch_sizes(std::ranges::size(input), std::ranges::size(output));
+        batch_apply<BatchOperation::INVERSE, M, M, M>(
+            pool, std::ranges::data(input), static_cast<const X*>(nullptr), std::ranges::data(output),
+            std::ranges::size(input)
+        );
+    }
+
+    template <FixedMatrixRange I, FixedMatrixRange O>
+    void batch_transpose(ThreadPool* pool, const I& input, O& output) {
+        using X = batch_matrix_t<I>;
+        static_assert(
+            std::is_same_v<batch_matrix_t<O>, decltype(std::declval<const X&>().transpose())>,
+            "Output Matrix type doesn't match"
+        );
+        check_batch_sizes(std::ranges::size(input), std::ranges::size(output));
+        // just moves cells around, nothing to vectorise
+        auto a = std::ranges::data(input);
+        auto out = std::ranges::data(output);
+        batch_for(pool, std::ranges::size(input), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                out[i] = a[i].transpose();
+            }
+        });
+    }
+} // namespace detail
+
+// operations applied to each of a batch of fixed-size matrices at once, for
+// when there are very many small matrices to work on
+// the batches are any contiguous ranges of matrices, such as std::span or
+// std::vector, and the output must be the same size as the input
+// the work is vectorised across the batch, and spread across a thread pool
+// when given a parallel execution policy (or when that's the default policy)
+namespace batch {
+    // output[i] = lhs[i] * rhs[i] for each pair of matrices in the batch
+    template <
+        execution::ExecutionPolicy Policy,
+        detail::FixedMatrixRange L,
+        detail::FixedMatrixRange R,
+        detail::FixedMatrixRange O
+    >
+    void multiply(const Policy& policy, const L& lhs, const R& rhs, O&& output) {
+        detail::batch_multiply(detail::execution_pool(policy), lhs, rhs, output);
+    }
+
+    template <detail::FixedMatrixRange L, detail::FixedMatrixRange R, detail::FixedMatrixRange O>
+    void multiply(const L& lhs, const R& rhs, O&& output) {
+        detail::batch_multiply(detail::default_execution_pool().load(), lhs, rhs, output);
+    }
+
+    // output[i] = input[i].determinant() for each square Matrix in the batch
+    template <execution::ExecutionPolicy Policy, detail::FixedMatrixRange I, typename O>
+    requires detail::ScalarRange<O, typename detail::batch_matrix_t<I>::value_type>
+    void determinant(const Policy& policy, const I& input, O&& output) {
+        detail::batch_determinant(detail::execution_pool(policy), input, output);
+    }
+
+    template <detail::FixedMatrixRange I, typename O>
+    requires detail::ScalarRange<O, typename detail::batch_matrix_t<I>::value_type>
+    void determinant(const I& input, O&& output) {
+        detail::batch_determinant(detail::default_execution_pool().load(), input, output);
+    }
+
+    // output[i] = the inverse of input[i] for each square Matrix in the batch
+    // throws an exception if any of them are singular
+    template <execution::ExecutionPolicy Policy, detail::FixedMatrixRange I, detail::FixedMatrixRange O>
+    void inverse(const Policy& policy, const I& input, O&& output) {
+        detail::batch_inverse(detail::execution_pool(policy), input, output);
+    }
+
+    template <detail::FixedMatrixRange I, detail::FixedMatrixRange O>
+    void inverse(const I& input, O&& output) {
+        detail::batch_inverse(detail::default_execution_pool().load(), input, output);
+    }
+
+    // output[i] = input[i].transpose() for each Matrix in the batch
+    template <execution::ExecutionPolicy Policy, detail::FixedMatrixRange I, detail::FixedMatrixRange O>
+    void transpose(const Policy& policy, const I& input, O&& output) {
+        detail::batch_transpose(detail::execution_pool(policy), input, output);
+    }
+
+    template <detail::FixedMatrixRange I, detail::FixedMatrixRange O>
+    void transpose(const I& input, O&& output) {
+        detail::batch_transpose(detail::default_execution_pool().load(), input, output);
+    }
+} // namespace batch
+} // namespace com::saxbophone::gryde
+#endif // include guard
@@ -0,0 +1,57 @@
+#ifndef COM_SAXBOPHONE_GRYDE_EXECUTION_HPP
+#define COM_SAXBOPHONE_GRYDE_EXECUTION_HPP
+
+#include <atomic>
+#include <concepts>
+
+#include <gryde/ThreadPool.hpp>
+
+namespace com::saxbophone::gryde {
+namespace execution {
+    // run sequentially on the calling thread
+    struct SequencedPolicy {};
+
+    // run in parallel on a ThreadPool, the default one unless another is given
+    struct ParallelPolicy {
+        ThreadPool* pool = nullptr;
+        // this policy, but running on the given pool
+        constexpr ParallelPolicy on(ThreadPool& other) const {
+            return ParallelPolicy{&other};
+        }
+    };
+
+    inline constexpr SequencedPolicy seq{};
+    inline constexpr ParallelPolicy par{};
+
+    template <typename P>
+    concept ExecutionPolicy = std::same_as<P, SequencedPolicy> or std::same_as<P, ParallelPolicy>;
+} // namespace execution
+
+namespace detail {
+    // the pool that operations not given an execution policy run on, or null
+    // to run them sequentially
+    inline std::atomic<ThreadPool*>& default_execution_pool() {
+        static std::atomic<ThreadPool*> pool = nullptr;
+        return pool;
+    }
+
+    // the pool that an execution policy runs on, null for sequential
+    constexpr ThreadPool* execution_pool(execution::SequencedPolicy) {
+        return nullptr;
+    }
+
+    inline ThreadPool* execution_pool(execution::ParallelPolicy policy) {
+        return policy.pool != nullptr ? policy.pool : &default_thread_pool();
+    }
+} // namespace detail
+
+namespace execution {
+    // sets the policy for operations not given one, such as multiplication of
+    // dynamic-size matrices with operator*, which is sequential unless changed
+    template <ExecutionPolicy Policy>
+    void set_default_policy(const Policy& policy) {
+        detail::default_execution_pool().store(detail::execution_pool(policy));
+    }
+} // namespace execution
+} // namespace com::saxbophone::gryde
+#endif // include guard
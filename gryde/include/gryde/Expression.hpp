@@ -0,0 +1,255 @@
+#ifndef COM_SAXBOPHONE_GRYDE_EXPRESSION_HPP
+#define COM_SAXBOPHONE_GRYDE_EXPRESSION_HPP
+
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <cstddef>
+
+#include <gryde/Layout.hpp>
+#include <gryde/detail/Simd.hpp>
+
+namespace com::saxbophone::gryde {
+namespace detail {
+    // the extent used to mark a dimension as only known at run-time
+    inline constexpr std::size_t DYNAMIC_EXTENT = std::numeric_limits<std::size_t>::max();
+
+    // extent of the result of combining two operands, fixed wins over dynamic
+    constexpr std::size_t combine_extents(std::size_t a, std::size_t b) {
+        return a == DYNAMIC_EXTENT ? b : a;
+    }
+
+    // checks two extents can be combined, dynamic extents are checked later
+    constexpr bool extents_compatible(std::size_t a, std::size_t b) {
+        return a == DYNAMIC_EXTENT or b == DYNAMIC_EXTENT or a == b;
+    }
+
+    // scalar operations, as function objects for ScalarExpression
+    struct MultiplyByScalar {
+        template <typename T>
+        constexpr T operator()(const T& cell, const T& scalar) const {
+            return cell * scalar;
+        }
+    };
+
+    struct ScalarMultiplyBy {
+        template <typename T>
+        constexpr T operator()(const T& cell, const T& scalar) const {
+            return scalar * cell;
+        }
+    };
+} // namespace detail
+
+// a lazily-evaluated element-wise computation on matrices, which is only
+// evaluated when it's used to construct a Matrix, in one pass over the cells
+// with no intermediate Matrix for any sub-expression
+// NOTE: expressions refer to the matrices they are built from rather than
+// copying them, so they must not outlive them
+template <typename E>
+concept MatrixExpression = requires(const E& expression, std::size_t i) {
+    typename E::value_type;
+    { E::ROWS } -> std::convertible_to<std::size_t>;
+    { E::COLS } -> std::convertible_to<std::size_t>;
+    // contiguous expressions also have their cells accessed by their index in
+    // the order of their LAYOUT, with expression[i]
+    { E::CONTIGUOUS } -> std::convertible_to<bool>;
+    { E::LAYOUT } -> std::convertible_to<Layout>;
+    { expression.row_count() } -> std::convertible_to<std::size_t>;
+    { expression.col_count() } -> std::convertible_to<std::size_t>;
+    { expression(i, i) } -> std::convertible_to<typename E::value_type>;
+};
+
+// leaf of an expression, refers to the cells of a Matrix, stored with layout L
+template <typename T, std::size_t M, std::size_t N, Layout L = Layout::ROW_MAJOR>
+class CellsExpression {
+public:
+    using value_type = T;
+    static constexpr std::size_t ROWS = M;
+    static constexpr std::size_t COLS = N;
+    static constexpr bool CONTIGUOUS = true;
+    static constexpr Layout LAYOUT = L;
+    constexpr CellsExpression(std::span<const T> cells, std::size_t m, std::size_t n)
+      : _cells(cells.data())
+      , _m(m)
+      , _n(n)
+      {}
+    constexpr std::size_t row_count() const { return _m; }
+    constexpr std::size_t col_count() const { return _n; }
+    constexpr const T& operator[](std::size_t i) const { return _cells[i]; }
+    constexpr const T& operator()(std::size_t m, std::size_t n) const {
+        return _cells[detail::cell_index<L>(m, n, _m, _n)];
+    }
+    constexpr const T* data() const { return _cells; }
+private:
+    const T* _cells;
+    std::size_t _m;
+    std::size_t _n;
+};
+
+// applies Op to each pair of corresponding cells of two expressions
+template <typename Op, MatrixExpression L, MatrixExpression R>
+class BinaryExpression {
+    static_assert(
+        std::is_same_v<typename L::value_type, typename R::value_type>,
+        "Matrix element types don't match"
+    );
+    static_assert(
+        detail::extents_compatible(L::ROWS, R::ROWS) and detail::extents_compatible(L::COLS, R::COLS),
+        "Matrix dimensions don't match"
+    );
+public:
+    using value_type = typename L::value_type;
+    static constexpr std::size_t ROWS = detail::combine_extents(L::ROWS, R::ROWS);
+    static constexpr std::size_t COLS = detail::combine_extents(L::COLS, R::COLS);
+    // cells can only be paired up by index if they're stored the same way
+    static constexpr bool CONTIGUOUS = L::CONTIGUOUS and R::CONTIGUOUS and L::LAYOUT == R::LAYOUT;
+    static constexpr Layout LAYOUT = L::LAYOUT;
+    constexpr BinaryExpression(const L& lhs, const R& rhs)
+      : _lhs(lhs)
+      , _rhs(rhs)
+      {
+        // validate dimensions, this only fails when one of them is dynamic
+        if (lhs.row_count() != rhs.row_count() or lhs.col_count() != rhs.col_count()) {
+            throw std::runtime_error("Matrix dimensions don't match");
+        }
+    }
+    constexpr std::size_t row_count() const { return _lhs.row_count(); }
+    constexpr std::size_t col_count() const { return _lhs.col_count(); }
+    constexpr value_type operator[](std::size_t i) const {
+        return Op{}(_lhs[i], _rhs[i]);
+    }
+    constexpr value_type operator()(std::size_t m, std::size_t n) const {
+        return Op{}(_lhs(m, n), _rhs(m, n));
+    }
+    constexpr const L& lhs() const { return _lhs; }
+    constexpr const R& rhs() const { return _rhs; }
+private:
+    L _lhs;
+    R _rhs;
+};
+
+// applies Op to each cell of an expression with a scalar
+template <typename Op, MatrixExpression E>
+class ScalarExpression {
+public:
+    using value_type = typename E::value_type;
+    static constexpr std::size_t ROWS = E::ROWS;
+    static constexpr std::size_t COLS = E::COLS;
+    static constexpr bool CONTIGUOUS = E::CONTIGUOUS;
+    static constexpr Layout LAYOUT = E::LAYOUT;
+    constexpr ScalarExpression(const E& expression, const value_type& scalar)
+      : _expression(expression)
+      , _scalar(scalar)
+      {}
+    constexpr std::size_t row_count() const { return _expression.row_count(); }
+    constexpr std::size_t col_count() const { return _expression.col_count(); }
+    constexpr value_type operator[](std::size_t i) const {
+        return Op{}(_expression[i], _scalar);
+    }
+    constexpr value_type operator()(std::size_t m, std::size_t n) const {
+        return Op{}(_expression(m, n), _scalar);
+    }
+    constexpr const E& expression() const { return _expression; }
+    constexpr const value_type& scalar() const { return _scalar; }
+private:
+    E _expression;
+    value_type _scalar;
+};
+
+namespace detail {
+    template <typename E>
+    inline constexpr bool is_cells_expression_v = false;
+
+    template <typename T, std::size_t M, std::size_t N, Layout L>
+    inline constexpr bool is_cells_expression_v<CellsExpression<T, M, N, L>> = true;
+
+    // binary operations which have vectorised kernels
+    template <typename Op>
+    inline constexpr bool has_simd_operation_v =
+        std::is_same_v<Op, std::plus<>> or std::is_same_v<Op, std::minus<>> or
+        std::is_same_v<Op, std::multiplies<>>;
+
+    template <typename Op>
+    inline constexpr simd::Operation simd_operation_v =
+        std::is_same_v<Op, std::plus<>> ? simd::Operation::ADD :
+        std::is_same_v<Op, std::minus<>> ? simd::Operation::SUBTRACT :
+        simd::Operation::MULTIPLY;
+
+    // expressions which are a single operation directly on Matrix cells, which
+    // are evaluated with vectorised kernels
+    template <typename E>
+    struct SimdForm {
+        static constexpr bool VALUE = false;
+    };
+
+    template <typename Op, typename L, typename R>
+    struct SimdForm<BinaryExpression<Op, L, R>> {
+        static constexpr bool VALUE =
+            has_simd_operation_v<Op> and
+            is_cells_expression_v<L> and is_cells_expression_v<R> and
+            simd::is_vectorisable_v<typename L::value_type>;
+        static constexpr simd::Operation OPERATION = simd_operation_v<Op>;
+    };
+
+    template <typename Op, typename E>
+    struct SimdForm<ScalarExpression<Op, E>> {
+        static constexpr bool VALUE =
+            is_cells_expression_v<E> and
+            simd::is_vectorisable_v<typename E::value_type>;
+        static constexpr simd::Operation OPERATION = simd::Operation::SCALE;
+    };
+
+    // writes the count cells of an expression to out with layout L, in one pass
+    // out may be the cells of one of the matrices in the expression, but not
+    // the storage behind a view in it, or a Matrix stored with another layout
+    template <Layout L = Layout::ROW_MAJOR, MatrixExpression E>
+    constexpr void evaluate(const E& expression, typename E::value_type* out, std::size_t count) {
+        using T = typename E::value_type;
+        // cells stored the same way as out can be evaluated by index
+        constexpr bool IN_ORDER = E::CONTIGUOUS and E::LAYOUT == L;
+        if constexpr (IN_ORDER and SimdForm<E>::VALUE) {
+            if (not std::is_constant_evaluated()) {
+                constexpr simd::Operation OPERATION = SimdForm<E>::OPERATION;
+                if constexpr (OPERATION == simd::Operation::SCALE) {
+                    simd::transform<OPERATION>(
+                        expression.expression().data(), static_cast<const T*>(nullptr),
+                        expression.scalar(), out, count
+                    );
+                } else {
+                    simd::transform<OPERATION>(
+                        expression.lhs().data(), expression.rhs().data(), T{}, out, count
+                    );
+                }
+                return;
+            }
+        }
+        if constexpr (IN_ORDER) {
+            for (std::size_t i = 0; i < count; i++) {
+                out[i] = expression[i];
+            }
+        } else if constexpr (L == Layout::ROW_MAJOR) {
+            // strided leaves and those with another layout don't have a flat
+            // index in the order of out, so go row by row
+            const std::size_t cols = expression.col_count();
+            for (std::size_t m = 0; cols != 0 and m < count / cols; m++) {
+                for (std::size_t n = 0; n < cols; n++) {
+                    out[m * cols + n] = expression(m, n);
+                }
+            }
+        } else {
+            // or column by column
+            const std::size_t rows = expression.row_count();
+            for (std::size_t n = 0; rows != 0 and n < count / rows; n++) {
+                for (std::size_t m = 0; m < rows; m++) {
+                    out[n * rows + m] = expression(m, n);
+                }
+            }
+        }
+    }
+} // namespace detail
+} // namespace com::saxbophone::gryde
+#endif // include guard
@@ -0,0 +1,199 @@
+#ifndef COM_SAXBOPHONE_GRYDE_LU_HPP
+#define COM_SAXBOPHONE_GRYDE_LU_HPP
+
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <gryde/Execution.hpp>
+#include <gryde/Layout.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/detail/BlockedLu.hpp>
+
+namespace com::saxbophone::gryde {
+// LU factorisation with partial pivoting of a square Matrix A, such that
+// P * A = L * U, which is kept so that it can be used again and again
+// once factorised, solving A * x = b costs O(n^2) per right-hand side rather
+// than the O(n^3) of factorising A again for each one
+// large matrices are factorised by blocks, in parallel when given a parallel
+// execution policy (or when that's the default policy)
+template <typename T>
+class LU {
+    static_assert(
+        std::is_floating_point_v<T>,
+        "LU factorisation is only implemented for floating-point Matrix"
+    );
+public:
+    using value_type = T;
+    // factorises a square Matrix of any kind, using the default execution policy
+    template <MatrixLike X>
+    explicit LU(const X& matrix) : LU(matrix, detail::default_execution_pool().load()) {}
+    // factorises a square Matrix of any kind, using the given execution policy
+    template <execution::ExecutionPolicy Policy, MatrixLike X>
+    LU(const Policy& policy, const X& matrix) : LU(matrix, detail::execution_pool(policy)) {}
+    // the number of rows and columns of the factorised Matrix
+    std::size_t size() const { return _factors.row_count(); }
+    // the unit lower triangular factor L
+    Matrix<T> lower() const {
+        Matrix<T> lower(size(), size());
+        for (std::size_t i = 0; i < size(); i++) {
+            for (std::size_t j = 0; j < i; j++) {
+                lower(i, j) = _factors(i, j);
+            }
+            lower(i, i) = T{1};
+        }
+        return lower;
+    }
+    // the upper triangular factor U
+    Matrix<T> upper() const {
+        Matrix<T> upper(size(), size());
+        for (std::size_t i = 0; i < size(); i++) {
+            for (std::size_t j = i; j < size(); j++) {
+                upper(i, j) = _factors(i, j);
+            }
+        }
+        return upper;
+    }
+    // the permutation P, as the row of A which ends up at each row of P * A
+    std::vector<std::size_t> permutation() const {
+        std::vector<std::size_t> rows(size());
+        std::iota(rows.begin(), rows.end(), std::size_t{0});
+        for (std::size_t k = 0; k < size(); k++) {
+            std::swap(rows[k], rows[_pivots[k]]);
+        }
+        return rows;
+    }
+    // whether the factorised Matrix is singular, i.e. U has a zero on its diagonal
+    bool is_singular() const {
+        for (std::size_t k = 0; k < size(); k++) {
+            if (_factors(k, k) == T{}) {
+                return true;
+            }
+        }
+        return false;
+    }
+    // the determinant of the factorised Matrix
+    T determinant() const {
+        T product = _parity < 0 ? T{-1} : T{1};
+        for (std::size_t k = 0; k < size(); k++) {
+            product *= _factors(k, k);
+        }
+        return product;
+    }
+    // solves A * x = b for x, throwing an exception if A is singular
+    std::vector<T> solve(std::span<const T> b) const {
+        if (b.size() != size()) {
+            throw std::runtime_error("Vector size is incompatible for solving");
+        }
+        _check_non_singular();
+        std::vector<T> x(b.begin(), b.end());
+        detail::lu_solve_blocked(_factors.contents().data(), size(), _pivots.data(), x.data(), 1, nullptr);
+        return x;
+    }
+    // solves A * X = B for X, where each column of B is a right-hand side,
+    // throwing an exception if A is singular
+    // uses the default execution policy
+    template <MatrixLike X>
+    Matrix<T> solve(const X& b) const {
+        return _solve(b, detail::default_execution_pool().load());
+    }
+    // solves A * X = B for X, where each column of B is a right-hand side,
+    // throwing an exception if A is singular
+    // uses the given execution policy
+    template <execution::ExecutionPolicy Policy, MatrixLike X>
+    Matrix<T> solve(const Policy& policy, const X& b) const {
+        return _solve(b, detail::execution_pool(policy));
+    }
+    // the inverse of the factorised Matrix, throwing an exception if it's singular
+    // uses the default execution policy
+    Matrix<T> inverse() const {
+        return _inverse(detail::default_execution_pool().load());
+    }
+    // the inverse of the factorised Matrix, throwing an exception if it's singular
+    // uses the given execution policy
+    template <execution::ExecutionPolicy Policy>
+    Matrix<T> inverse(const Policy& policy) const {
+        return _inverse(detail::execution_pool(policy));
+    }
+private:
+    template <MatrixLike X>
+    LU(const X& matrix, ThreadPool* pool)
+      : _factors(matrix.row_count(), matrix.col_count())
+      , _pivots(matrix.row_count())
+      , _parity(1)
+      {
+        static_assert(
+            std::is_same_v<typename X::value_type, T>,
+            "Matrix element type doesn't match"
+        );
+        // the factorisation works on row-major cells
+        detail::copy_cells<Layout::ROW_MAJOR>(matrix, _factors.contents());
+        // do check for square Matrix at run-time
+        if (matrix.row_count() != matrix.col_count()) {
+            throw std::runtime_error("LU factorisation is undefined for non-square Matrix");
+        }
+        _parity = detail::lu_factorise_blocked(
+            _factors.contents().data(), size(), _pivots.data(), pool
+        );
+    }
+
+    void _check_non_singular() const {
+        if (is_singular()) {
+            throw std::runtime_error("Matrix is singular");
+        }
+    }
+
+    template <MatrixLike X>
+    Matrix<T> _solve(const X& b, ThreadPool* pool) const {
+        static_assert(
+            std::is_same_v<typename X::value_type, T>,
+            "Matrix element type doesn't match"
+        );
+        if (b.row_count() != size()) {
+            throw std::runtime_error("Matrix dimensions are incompatible for solving");
+        }
+        _check_non_singular();
+        Matrix<T> x(b.row_count(), b.col_count());
+        detail::copy_cells<Layout::ROW_MAJOR>(b, x.contents());
+        detail::lu_solve_blocked(
+            _factors.contents().data(), size(), _pivots.data(),
+            x.contents().data(), x.col_count(), pool
+        );
+        return x;
+    }
+
+    Matrix<T> _inverse(ThreadPool* pool) const {
+        _check_non_singular();
+        // solve for the columns of the identity
+        Matrix<T> inverse(size(), size());
+        for (std::size_t k = 0; k < size(); k++) {
+            inverse(k, k) = T{1};
+        }
+        detail::lu_solve_blocked(
+            _factors.contents().data(), size(), _pivots.data(),
+            inverse.contents().data(), size(), pool
+        );
+        return inverse;
+    }
+
+    // L below the diagonal (its unit diagonal is implied), U on and above it
+    Matrix<T> _factors;
+    // the row swapped with each row during factorisation
+    std::vector<std::size_t> _pivots;
+    // parity of the row permutation
+    int _parity;
+};
+
+// deduces the element type of the LU factorisation from the Matrix
+template <MatrixLike X>
+LU(const X&) -> LU<typename X::value_type>;
+
+template <execution::ExecutionPolicy Policy, MatrixLike X>
+LU(const Policy&, const X&) -> LU<typename X::value_type>;
+} // namespace com::saxbophone::gryde
+#endif // include guard
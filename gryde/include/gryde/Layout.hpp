@@ -0,0 +1,55 @@
+#ifndef COM_SAXBOPHONE_GRYDE_LAYOUT_HPP
+#define COM_SAXBOPHONE_GRYDE_LAYOUT_HPP
+
+#include <concepts>
+
+#include <cstddef>
+
+namespace com::saxbophone::gryde {
+// the order in which the cells of a Matrix are stored
+enum class Layout {
+    ROW_MAJOR,    // each row after the other, as in C
+    COLUMN_MAJOR, // each column after the other, as in Fortran, BLAS and LAPACK
+};
+
+namespace detail {
+    // the other layout
+    constexpr Layout opposite_layout(Layout layout) {
+        return layout == Layout::ROW_MAJOR ? Layout::COLUMN_MAJOR : Layout::ROW_MAJOR;
+    }
+
+    // index of cell (m, n) in the cells of a matrix of the given dimensions
+    // stored with layout L
+    template <Layout L>
+    constexpr std::size_t cell_index(std::size_t m, std::size_t n, std::size_t rows, std::size_t cols) {
+        if constexpr (L == Layout::ROW_MAJOR) {
+            return m * cols + n;
+        } else {
+            return n * rows + m;
+        }
+    }
+
+    // distance between the cells of consecutive rows of a matrix of the given
+    // dimensions stored with layout L
+    template <Layout L>
+    constexpr std::size_t row_stride([[maybe_unused]] std::size_t rows, [[maybe_unused]] std::size_t cols) {
+        return L == Layout::ROW_MAJOR ? cols : 1;
+    }
+
+    // distance between the cells of consecutive columns
+    template <Layout L>
+    constexpr std::size_t col_stride([[maybe_unused]] std::size_t rows, [[maybe_unused]] std::size_t cols) {
+        return L == Layout::ROW_MAJOR ? 1 : rows;
+    }
+
+    // the layout of the cells of any kind of Matrix, which is row-major for
+    // those that don't say otherwise with a static layout member
+    template <typename X>
+    inline constexpr Layout layout_of_v = Layout::ROW_MAJOR;
+
+    template <typename X>
+    requires requires { { X::layout } -> std::convertible_to<Layout>; }
+    inline constexpr Layout layout_of_v<X> = X::layout;
+} // namespace detail
+} // namespace com::saxbophone::gryde
+#endif // include guard
@@ -1,23 +1,81 @@
 #ifndef COM_SAXBOPHONE_GRYDE_MATRIX_HPP
 #define COM_SAXBOPHONE_GRYDE_MATRIX_HPP
 
+#include <algorithm>
 #include <array>
+#include <concepts>
+#include <functional>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+
+#include <gryde/AlignedAllocator.hpp>
+#include <gryde/Execution.hpp>
+#include <gryde/Expression.hpp>
+#include <gryde/Layout.hpp>
+#include <gryde/MatrixView.hpp>
+#include <gryde/ThreadPool.hpp>
+#include <gryde/detail/Blas.hpp>
+#include <gryde/detail/BlockedLu.hpp>
+#include <gryde/detail/ClosedForm.hpp>
+#include <gryde/detail/Determinant.hpp>
+#include <gryde/detail/Gemm.hpp>
+#include <gryde/detail/Lu.hpp>
+#include <gryde/detail/ParallelGemm.hpp>
+#include <gryde/detail/SmallVector.hpp>
+
+// when enabled, Matrix::operator() checks its indices and throws just like
+// Matrix::at() does, otherwise they are only checked by assertions, which are
+// compiled out of release builds, so that cell access is as cheap as possible
+#ifndef GRYDE_CHECKED_CELL_ACCESS
+#define GRYDE_CHECKED_CELL_ACCESS 0
+#endif
+
+// dynamic-size matrices with up to this many cells keep them inside the Matrix
+// object instead of allocating them, as do the scratch copies made of them
+#ifndef GRYDE_SMALL_MATRIX_CELLS
+#define GRYDE_SMALL_MATRIX_CELLS 16
+#endif
 
 namespace com::saxbophone::gryde {
-// abstract base class defining the interface of a class implementing
-// Matrix functionality
+// the static interface shared by all kinds of Matrix, which the internal
+// algorithms are written against so that they compile down to direct access
+// to the cells without any virtual calls
+template <typename X>
+concept MatrixLike = requires(const X& const_matrix, std::size_t i) {
+    typename X::value_type;
+    { const_matrix.row_count() } -> std::convertible_to<std::size_t>;
+    { const_matrix.col_count() } -> std::convertible_to<std::size_t>;
+    // cells of the matrix, row-major unless the layout member of X says
+    // otherwise (see detail::layout_of_v)
+    { const_matrix.contents() } -> std::convertible_to<std::span<const typename X::value_type>>;
+    { const_matrix(i, i) } -> std::convertible_to<const typename X::value_type&>;
+};
+
+// a MatrixLike whose cells can also be written to, which read-only ones (such
+// as a MappedMatrix of const cells) can't
+template <typename X>
+concept WritableMatrixLike = MatrixLike<X> and requires(X& matrix) {
+    { matrix.contents() } -> std::convertible_to<std::span<typename X::value_type>>;
+};
+
+// abstract base class defining a type-erased interface to any kind of Matrix
+// matrices don't derive from this, wrap them in a PolymorphicMatrix to store
+// matrices of different kinds together or to pass them across API boundaries
 template <typename T>
 class MatrixBase {
 public:
+    using value_type = T;
     // vritual destructor required due to C++ language rules
     virtual constexpr ~MatrixBase() = default;
     // getters for dimensions
@@ -39,12 +97,43 @@ public:
     constexpr static bool dimensions_match(const MatrixBase& lhs, const MatrixBase& rhs) {
         return lhs.dimensions() == rhs.dimensions();
     }
-protected:
-    // helper to unpack initializer_lists in ctors
-    // XXX: because this method is called from a ctor, we have to avoid
-    // using any virtual methods in it, hence the need to pass col_count
-    // and contents explicitly
-    static constexpr void _unpack_initializer_list(
+    // generic helper method for determining if two matrices can be multiplied
+    constexpr static bool dimensions_compatible(const MatrixBase& lhs, const MatrixBase& rhs) {
+        return lhs.col_count() == rhs.row_count();
+    }
+};
+
+namespace detail {
+    inline constexpr std::size_t SMALL_MATRIX_CELLS = GRYDE_SMALL_MATRIX_CELLS;
+
+    // storage for a run-time number of cells, which doesn't allocate when
+    // there are few of them
+    template <typename T, typename Allocator = std::allocator<T>>
+    using CellStorage = SmallVector<T, SMALL_MATRIX_CELLS, Allocator>;
+
+    template <typename X>
+    inline constexpr bool is_matrix_view_v = false;
+
+    template <typename T>
+    inline constexpr bool is_matrix_view_v<MatrixView<T>> = true;
+
+    // anything that can be an operand of a matrix multiplication
+    template <typename X>
+    concept MultiplicationOperand = MatrixLike<X> or is_matrix_view_v<X>;
+
+    // helper for determining matching matrix dimensions
+    template <MatrixLike L, MatrixLike R>
+    constexpr bool dimensions_match(const L& lhs, const R& rhs) {
+        return lhs.row_count() == rhs.row_count() and lhs.col_count() == rhs.col_count();
+    }
+    // helper for determining if two matrices can be multiplied
+    template <MultiplicationOperand L, MultiplicationOperand R>
+    constexpr bool dimensions_compatible(const L& lhs, const R& rhs) {
+        return lhs.col_count() == rhs.row_count();
+    }
+    // helper to unpack initializer_lists in ctors, into cells with layout L
+    template <typename T, Layout L = Layout::ROW_MAJOR>
+    constexpr void unpack_initializer_list(
         std::initializer_list<std::initializer_list<T>> l,
         std::size_t col_count,
         std::span<T> contents
@@ -58,53 +147,119 @@ protected:
             }
             std::size_t col_n = 0;
             for (auto col : row) {
-                contents[row_n * col_count + col_n] = col;
+                contents[cell_index<L>(row_n, col_n, l.size(), col_count)] = col;
                 col_n++;
             }
             row_n++;
         }
     }
     // helper for making submatrices
-    constexpr void _populate_submatrix(
-        MatrixBase& submatrix,
+    template <MatrixLike Source, WritableMatrixLike Destination>
+    constexpr void populate_submatrix(
+        const Source& source,
+        Destination& submatrix,
         std::size_t row,
         std::size_t col
-    ) const {
-        // cursor indices for output to new matrix
-        std::size_t p = 0;
-        std::size_t q = 0;
-        for (std::size_t m = 0; m < this->row_count(); m++) {
-            for (std::size_t n = 0; n < this->col_count(); n++) {
-                // skip cells from removed row/column
-                if (m == row or n == col) { continue; }
-                submatrix(p, q) = this->operator()(m, n);
-                // advance the cursors
-                q++;
-                if (q == submatrix.col_count()) {
-                    q = 0;
-                    p++;
+    ) {
+        // cursor row for output to new matrix
+        std::size_t i = 0;
+        for (std::size_t m = 0; m < source.row_count(); m++) {
+            // skip cells from removed row/column
+            if (m == row) { continue; }
+            std::size_t j = 0;
+            for (std::size_t n = 0; n < source.col_count(); n++) {
+                if (n == col) { continue; }
+                submatrix(i, j++) = source(m, n);
+            }
+            i++;
+        }
+    }
+    // copies the cells of any kind of Matrix to out, in the order of layout L
+    template <Layout L, MatrixLike Source>
+    constexpr void copy_cells(const Source& source, std::span<typename Source::value_type> out) {
+        if constexpr (layout_of_v<Source> == L) {
+            std::ranges::copy(source.contents(), out.begin());
+        } else {
+            const std::size_t rows = source.row_count();
+            const std::size_t cols = source.col_count();
+            for (std::size_t m = 0; m < rows; m++) {
+                for (std::size_t n = 0; n < cols; n++) {
+                    out[cell_index<L>(m, n, rows, cols)] = source(m, n);
                 }
             }
         }
     }
-    // helper for element-wise addition between matrices
-    static constexpr void _element_wise_addition(const MatrixBase& lhs, const MatrixBase& rhs, MatrixBase& result) {
-        for (std::size_t m = 0; m < result.row_count(); m++) {
-            for (std::size_t n = 0; n < result.col_count(); n++) {
-                result(m, n) = lhs(m, n) + rhs(m, n);
+    // the accessor that GEMM reads the cells of a multiplication operand with
+    template <MatrixLike X>
+    constexpr StridedCells<typename X::value_type> gemm_operand(const X& matrix) {
+        constexpr Layout L = layout_of_v<X>;
+        return {
+            matrix.contents().data(),
+            row_stride<L>(matrix.row_count(), matrix.col_count()),
+            col_stride<L>(matrix.row_count(), matrix.col_count()),
+        };
+    }
+    template <typename T>
+    constexpr const MatrixView<T>& gemm_operand(const MatrixView<T>& view) {
+        return view;
+    }
+    // the accessor for the transpose of a multiplication operand
+    template <typename T>
+    constexpr StridedCells<T> transpose_operand(const StridedCells<T>& cells) {
+        return {cells.data, cells.col_stride, cells.row_stride};
+    }
+    template <typename T>
+    constexpr MatrixView<T> transpose_operand(const MatrixView<T>& view) {
+        return view.transpose();
+    }
+    // helper for matrix multiplication, result must be zero-initialised and
+    // of dimensions lhs.row_count() * rhs.col_count()
+    // runs in parallel on pool if it's not null
+    template <MultiplicationOperand L, MultiplicationOperand R, WritableMatrixLike Result>
+    constexpr void matrix_multiplication(const L& lhs, const R& rhs, Result& result, ThreadPool* pool = nullptr) {
+        using T = typename Result::value_type;
+        auto multiply = [&](std::size_t m, std::size_t n, std::size_t k, const auto& a, const auto& b, std::size_t ldc) {
+            if constexpr (USES_BLAS_V<T>) {
+                if (not std::is_constant_evaluated() and blas_gemm(m, n, k, a, b, result.contents().data(), ldc)) {
+                    return;
+                }
+            }
+            if (pool != nullptr) {
+                parallel_gemm(*pool, m, n, k, a, b, result.contents().data(), ldc);
+            } else {
+                gemm(m, n, k, a, b, result.contents().data(), ldc);
             }
+        };
+        if constexpr (layout_of_v<Result> == Layout::ROW_MAJOR) {
+            multiply(
+                lhs.row_count(), rhs.col_count(), lhs.col_count(),
+                gemm_operand(lhs), gemm_operand(rhs), result.col_count()
+            );
+        } else {
+            // the column-major cells of the product are the row-major cells of
+            // its transpose, the product of the transposes in reverse order
+            multiply(
+                rhs.col_count(), lhs.row_count(), lhs.col_count(),
+                transpose_operand(gemm_operand(rhs)), transpose_operand(gemm_operand(lhs)),
+                result.row_count()
+            );
         }
-        return;
     }
-};
+} // namespace detail
 
+// Allocator is only used by dynamic-size Matrix, for the storage of its cells
+// L is the order the cells are stored in, which is the order of contents()
 template <
     typename T,
     std::size_t M = std::numeric_limits<size_t>::max(),
-    std::size_t N = std::numeric_limits<size_t>::max()
+    std::size_t N = std::numeric_limits<size_t>::max(),
+    typename Allocator = AlignedAllocator<T>,
+    Layout L = Layout::ROW_MAJOR
 >
-class Matrix : public MatrixBase<T> {
+class Matrix {
 public:
+    using value_type = T;
+    static constexpr Layout layout = L;
     // default ctor, default-initialised all elements
     constexpr Matrix() : _contents{} {}
     // this ctor sets elements from initialiser list
@@ -116,9 +271,9 @@ public:
             throw std::runtime_error("Top-level initializer_list is wrong size");
         }
         // set contents of each row one by one (we allow shortened rows)
-        MatrixBase<T>::_unpack_initializer_list(l, N, this->_contents);
+        detail::unpack_initializer_list<T, L>(l, N, this->_contents);
     }
-    // this ctor sets elements from dynamic-size span
+    // this ctor sets elements from dynamic-size span, in the order of layout
     constexpr Matrix(std::span<const T> s) : _contents{} {
         // validate span size
         if (s.size() != M * N) {
@@ -128,44 +283,103 @@ public:
             _contents[i] = s[i];
         }
     }
-    // this ctor initialises fixed Matrix from a dynamic Matrix
-    explicit Matrix(const Matrix<T>& other)
+    // this ctor initialises fixed Matrix from a dynamic Matrix, or from a
+    // fixed Matrix with the other layout
+    template <std::size_t P, std::size_t Q, typename A, Layout K>
+    requires (
+        (P == detail::DYNAMIC_EXTENT and Q == detail::DYNAMIC_EXTENT) or
+        (P == M and Q == N and K != L)
+    )
+    constexpr explicit Matrix(const Matrix<T, P, Q, A, K>& other)
       : Matrix()
       {
         // check dimensions of other match our dimensions
-        if (not MatrixBase<T>::dimensions_match(*this, other)) {
+        if (not detail::dimensions_match(*this, other)) {
             throw std::runtime_error("Matrix dimensions don't match");
         }
-        // use compile-time-sized subspan to convert dynamic span to fixed span
-        // this would be UB if we didn't check for correct size first
-        auto cells = other.contents().template subspan<0, M * N>();
-        for (std::size_t i = 0; i < M * N; i++) {
-            _contents[i] = cells[i];
+        detail::copy_cells<L>(other, this->contents());
+    }
+    // this ctor evaluates an element-wise expression of matrices
+    template <MatrixExpression E>
+    constexpr Matrix(const E& expression) : _contents{} {
+        static_assert(
+            detail::extents_compatible(E::ROWS, M) and detail::extents_compatible(E::COLS, N),
+            "Matrix dimensions don't match"
+        );
+        // validate dimensions, this only fails when the expression is dynamic
+        if (expression.row_count() != M or expression.col_count() != N) {
+            throw std::runtime_error("Matrix dimensions don't match");
+        }
+        detail::evaluate<L>(expression, _contents.data(), M * N);
+    }
+    // evaluates an element-wise expression of matrices into this Matrix,
+    // in place when it can't read cells of this Matrix it's already written
+    template <MatrixExpression E>
+    constexpr Matrix& operator=(const E& expression) {
+        if constexpr (E::CONTIGUOUS and E::LAYOUT == L) {
+            static_assert(
+                detail::extents_compatible(E::ROWS, M) and detail::extents_compatible(E::COLS, N),
+                "Matrix dimensions don't match"
+            );
+            // validate dimensions, this only fails when the expression is dynamic
+            if (expression.row_count() != M or expression.col_count() != N) {
+                throw std::runtime_error("Matrix dimensions don't match");
+            }
+            detail::evaluate<L>(expression, _contents.data(), M * N);
+            return *this;
+        } else {
+            return *this = Matrix(expression);
         }
     }
-    // vritual destructor required due to C++ language rules
-    virtual constexpr ~Matrix() = default;
     // getters for dimensions
-    constexpr std::size_t row_count() const override { return M; }
-    constexpr std::size_t col_count() const override { return N; }
+    constexpr std::size_t row_count() const { return M; }
+    constexpr std::size_t col_count() const { return N; }
+    // get matrix dimensions as pair of <rows, columns>
+    constexpr std::pair<std::size_t, std::size_t> dimensions() const {
+        return {M, N};
+    }
     // equality operator
     constexpr bool operator==(const Matrix& other) const {
+        if constexpr (detail::simd::is_vectorisable_v<T>) {
+            if (not std::is_constant_evaluated()) {
+                return detail::simd::equal(_contents.data(), other._contents.data(), M * N);
+            }
+        }
         return this->_contents == other._contents;
     }
+    // compare with fixed-sized Matrix with the other layout
+    template <typename A, Layout K>
+    requires (K != L)
+    constexpr bool operator==(const Matrix<T, M, N, A, K>& other) const {
+        return *this == Matrix(other);
+    }
     // compare with dynamic-sized Matrix
-    bool operator==(const Matrix<T>& other) const {
-        return (Matrix<T>)*this == other;
+    template <typename A, Layout K>
+    bool operator==(const Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, A, K>& other) const {
+        return Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, A, K>(*this) == other;
     }
     // read-only accessor for matrix contents
-    constexpr std::span<const T> contents() const override {
+    constexpr std::span<const T> contents() const {
         return std::span<const T>(_contents);
     }
     // read-write accessor for matrix contents
-    constexpr std::span<T> contents() override {
+    constexpr std::span<T> contents() {
         return std::span<T>(_contents);
     }
-    // read-only accessor for a specific cell of the Matrix
-    constexpr const T& operator()(std::size_t m, std::size_t n) const override {
+    // read-only view of the whole Matrix
+    constexpr MatrixView<const T> view() const {
+        return MatrixView<const T>(
+            _contents.data(), M, N, detail::row_stride<L>(M, N), detail::col_stride<L>(M, N)
+        );
+    }
+    // read-write view of the whole Matrix
+    constexpr MatrixView<T> view() {
+        return MatrixView<T>(
+            _contents.data(), M, N, detail::row_stride<L>(M, N), detail::col_stride<L>(M, N)
+        );
+    }
+    // read-only accessor for a specific cell of the Matrix, bounds-checked
+    constexpr const T& at(std::size_t m, std::size_t n) const {
         /*
          * avoid -Wtype-limits warning diagnostic for always-false comparison
          * when either of M or N are 0
@@ -177,110 +391,178 @@ public:
             if (m >= M or n >= N) { // compiler complains for check when zero-size
                 throw std::runtime_error("Matrix[] indices out of bounds");
             }
-            return _contents[m * N + n];
+            return _contents[detail::cell_index<L>(m, n, M, N)];
         }
     }
-    // read-write accessor for a specific cell of the Matrix
-    constexpr T& operator()(std::size_t m, std::size_t n) override {
-        /*
-         * avoid -Wtype-limits warning diagnostic for always-false comparison
-         * when either of M or N are 0
-         */
+    // read-write accessor for a specific cell of the Matrix, bounds-checked
+    constexpr T& at(std::size_t m, std::size_t n) {
         if constexpr (M == 0 or N == 0) {
             throw std::runtime_error("Matrix is empty");
         } else {
             // validate indices
-            if (m >= M or n >= N) { // compiler complains for check when zero-size
+            if (m >= M or n >= N) {
                 throw std::runtime_error("Matrix[] indices out of bounds");
             }
-            return _contents[m * N + n];
+            return _contents[detail::cell_index<L>(m, n, M, N)];
+        }
+    }
+    // read-only accessor for a specific cell of the Matrix
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    constexpr const T& operator()(std::size_t m, std::size_t n) const {
+        if constexpr (M == 0 or N == 0 or GRYDE_CHECKED_CELL_ACCESS) {
+            return at(m, n);
+        } else {
+            assert(m < M and n < N);
+            return _contents[detail::cell_index<L>(m, n, M, N)];
+        }
+    }
+    // read-write accessor for a specific cell of the Matrix
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    constexpr T& operator()(std::size_t m, std::size_t n) {
+        if constexpr (M == 0 or N == 0 or GRYDE_CHECKED_CELL_ACCESS) {
+            return at(m, n);
+        } else {
+            assert(m < M and n < N);
+            return _contents[detail::cell_index<L>(m, n, M, N)];
         }
     }
     // calculates determinant for square Matrices
+    // NOTE: the cells of either layout work, the transpose has the same one
     constexpr T determinant() const {
         // check that the Matrix is square at compile-time
         static_assert(M == N, "Determinant is undefined for non-square Matrix");
         // rule out special cases
         if constexpr (M == 0) {
             return T{1};
-        } else if constexpr (M == 1) {
-            return this->_contents[0];
+        } else if constexpr (
+            detail::is_closed_form_extent(M) and
+            not (detail::is_exact_integer_v<T> and M >= detail::ELIMINATION_DETERMINANT_MIN_SIZE)
+        ) {
+            // integers large enough to be eliminated are, as for dynamic-size
+            // Matrix, so that overflow is always checked for
+            return detail::closed_form_determinant<M>(this->_contents.data());
+        } else if constexpr (std::is_floating_point_v<T> and M >= detail::ELIMINATION_DETERMINANT_MIN_SIZE) {
+            // factorise a copy of the contents, determinant is product of the diagonal
+            std::array<T, M * N> cells = this->_contents;
+            return detail::lu_determinant(cells.data(), M);
+        } else if constexpr (detail::is_exact_integer_v<T> and M >= detail::ELIMINATION_DETERMINANT_MIN_SIZE) {
+            // exact fraction-free elimination on widened copy of the contents
+            std::array<std::intmax_t, M * N> cells = {};
+            return detail::bareiss_determinant(this->contents(), cells.data(), M);
         } else {
-            // recursively calculate determinant
-            // get the first row of values
-            std::span<const T, N> top_row = this->contents().template subspan<0, N>();
-            // make an array of each corresponding submatrix
-            std::array<Matrix<T, M - 1, N - 1>, N> submatrices;
-            for (std::size_t col = 0; col < N; col++) {
-                submatrices[col] = this->submatrix(0, col);
-            }
-            // sum by adding each entry and subtracting each other entry
-            T sum = {};
-            for (std::size_t col = 0; col < N; col++) {
-                if (col % 2 == 0) { // add when even
-                    sum += top_row[col] * submatrices[col].determinant();
-                } else { // subtract when odd
-                    sum -= top_row[col] * submatrices[col].determinant();
-                }
-            }
-            return sum;
+            // cofactor expansion in place, without building submatrices
+            static_assert(
+                M <= detail::COFACTOR_DETERMINANT_MAX_SIZE,
+                "Matrix is too large for cofactor expansion"
+            );
+            return detail::cofactor_determinant(this->contents(), M);
         }
     }
-    // fixed-Matrix + fixed-Matrix
-    constexpr Matrix operator+(const Matrix& other) const {
-        Matrix result;
-        MatrixBase<T>::_element_wise_addition(*this, other, result);
-        return result;
+    // calculates rank, the number of linearly independent rows or columns
+    constexpr std::size_t rank() const {
+        // as for determinant(), the layout doesn't matter
+        static_assert(
+            std::is_floating_point_v<T> or detail::is_exact_integer_v<T>,
+            "Rank is only implemented for floating-point or integer Matrix"
+        );
+        if constexpr (std::is_floating_point_v<T>) {
+            std::array<T, M * N> cells = this->_contents;
+            return detail::lu_rank(cells.data(), M, N);
+        } else {
+            std::array<std::intmax_t, M * N> cells = {};
+            return detail::bareiss_rank(this->contents(), cells.data(), M, N);
+        }
     }
-    // fixed-Matrix + dynamic-Matrix
-    Matrix operator+(const Matrix<T>& other) const {
-        // validate dimensions
-        if (not MatrixBase<T>::dimensions_match(*this, other)) {
-            throw std::runtime_error("Matrix dimensions don't match");
+    // calculates the inverse of square floating-point Matrices, throwing an
+    // exception if the Matrix is singular
+    // NOTE: the inverse of the transpose is the transpose of the inverse, so
+    // this works on the cells of either layout
+    constexpr Matrix inverse() const {
+        static_assert(M == N, "Inverse is undefined for non-square Matrix");
+        static_assert(std::is_floating_point_v<T>, "Inverse is only implemented for floating-point Matrix");
+        Matrix inverse;
+        if constexpr (detail::is_closed_form_extent(M)) {
+            // adjugate divided by the determinant
+            T determinant = detail::closed_form_adjugate<M>(this->_contents.data(), inverse._contents.data());
+            if (determinant == T{}) {
+                throw std::runtime_error("Matrix is singular");
+            }
+            for (auto& cell : inverse._contents) {
+                cell /= determinant;
+            }
+        } else {
+            std::array<T, M * N> cells = this->_contents;
+            std::array<std::size_t, M> pivots = {};
+            if (not detail::lu_inverse(cells.data(), M, pivots.data(), inverse._contents.data())) {
+                throw std::runtime_error("Matrix is singular");
+            }
         }
-        Matrix result;
-        MatrixBase<T>::_element_wise_addition(*this, other, result);
-        return result;
-    }
-    // fixed-Matrix * scalar
-    constexpr Matrix operator*(const T& scalar) const {
-        // TODO: implement scalar multiplication
-        return {};
-    }
-    // fixed-Matrix * fixed-Matrix
-    template <std::size_t P>
-    constexpr Matrix<T, M, P> operator*(const Matrix<T, N, P>& other) const {
-        // Matrix multiplication
-        Matrix<T, M, P> output;
-        for (std::size_t m = 0; m < M; m++) {
-            for (std::size_t p = 0; p < P; p++) {
-                // every new cell (m, p) in output matrix:
-                for (std::size_t n = 0; n < N; n++) {
-                    output(m, p) += ((*this)(m, n) * other(n, p));
-                }
+        return inverse;
+    }
+    // fixed-Matrix * fixed-Matrix, the product has the layout of this one
+    template <std::size_t P, typename A, Layout K>
+    constexpr Matrix<T, M, P, Allocator, L> operator*(const Matrix<T, N, P, A, K>& other) const {
+        Matrix<T, M, P, Allocator, L> output;
+        if constexpr (
+            detail::is_closed_form_extent(M) and detail::is_closed_form_extent(N) and
+            detail::is_closed_form_extent(P) and K == L
+        ) {
+            if constexpr (L == Layout::ROW_MAJOR) {
+                detail::unrolled_multiply<M, N, P>(
+                    this->_contents.data(), other.contents().data(), output.contents().data()
+                );
+            } else {
+                // column-major cells are the row-major cells of the transpose
+                detail::unrolled_multiply<P, N, M>(
+                    other.contents().data(), this->_contents.data(), output.contents().data()
+                );
             }
+        } else {
+            detail::matrix_multiplication(*this, other, output);
         }
         return output;
     }
     // fixed-Matrix * dynamic-Matrix
-    Matrix<T> operator*(const Matrix<T>& other) const {
-        // TODO: validate compatible dimensions at run-time? (or just relegate check to casting constructor?)
-        // TODO: implement Matrix multiplication
-        return {};
-    }
-    // fixed-Matrix transposition
-    constexpr Matrix<T, N, M> transpose() const {
-        Matrix<T, N, M> transposed;
-        // write the rows of this as the columns of transposed
-        for (std::size_t m = 0; m < M; m++) {
-            for (std::size_t n = 0; n < N; n++) {
-                transposed(n, m) = (*this)(m, n);
+    template <typename A, Layout K>
+    Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, A, L> operator*(
+        const Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, A, K>& other
+    ) const {
+        // validate dimensions
+        if (not detail::dimensions_compatible(*this, other)) {
+            throw std::runtime_error("Matrix dimensions are incompatible for multiplication");
+        }
+        Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, A, L> output(
+            M, other.col_count(), other.get_allocator()
+        );
+        detail::matrix_multiplication(*this, other, output, detail::default_execution_pool().load());
+        return output;
+    }
+    // fixed-Matrix transposition, with the same layout
+    constexpr Matrix<T, N, M, Allocator, L> transpose() const {
+        Matrix<T, N, M, Allocator, L> transposed;
+        auto cells = transposed.contents();
+        // the cells are stored as R rows of C cells in the order of the layout
+        constexpr std::size_t R = L == Layout::ROW_MAJOR ? M : N;
+        constexpr std::size_t C = L == Layout::ROW_MAJOR ? N : M;
+        if constexpr (detail::is_closed_form_extent(M) and detail::is_closed_form_extent(N)) {
+            detail::unrolled_transpose<R, C>(_contents.data(), cells.data());
+        } else {
+            // write the rows of this as the columns of transposed
+            for (std::size_t r = 0; r < R; r++) {
+                for (std::size_t c = 0; c < C; c++) {
+                    cells[c * R + r] = _contents[r * C + c];
+                }
             }
         }
         return transposed;
     }
+    // the transpose, without moving any cells: the cells of this Matrix in
+    // one layout are those of its transpose in the other one
+    constexpr Matrix<T, N, M, Allocator, detail::opposite_layout(L)> flip_layout() const {
+        return Matrix<T, N, M, Allocator, detail::opposite_layout(L)>(this->contents());
+    }
     // returns a new fixed-Matrix with the specified row and column removed
-    constexpr Matrix<T, M - 1, N - 1> submatrix(std::size_t row, std::size_t col) const {
+    constexpr Matrix<T, M - 1, N - 1, Allocator, L> submatrix(std::size_t row, std::size_t col) const {
         // prevent wrap-around on underflow making huge matrices
         static_assert(M > 0 and N > 0, "No more rows or columns to remove");
         // validate row and column indices
@@ -288,24 +570,22 @@ public:
             throw std::runtime_error("Row or column index out of bounds");
         }
         // make a smaller matrix
-        Matrix<T, M - 1, N - 1> sub;
+        Matrix<T, M - 1, N - 1, Allocator, L> sub;
         // populate it from all cells except those from the removed row and column
-        this->_populate_submatrix(sub, row, col);
+        detail::populate_submatrix(*this, sub, row, col);
         return sub;
     }
     // returns a new fixed-Matrix with the specified row removed
-    constexpr Matrix<T, M - 1, N> remove_row(std::size_t row) const {
+    constexpr Matrix<T, M - 1, N, Allocator, L> remove_row(std::size_t row) const {
         // prevent wrap-around on underflow making huge matrices
         static_assert(M > 0, "No more rows to remove");
-        // TODO: implement
-        return {};
+        return Matrix<T, M - 1, N, Allocator, L>(this->view().remove_row(row));
     }
     // returns a new fixed-Matrix with the specified column removed
-    constexpr Matrix<T, M, N - 1> remove_col(std::size_t col) const {
+    constexpr Matrix<T, M, N - 1, Allocator, L> remove_col(std::size_t col) const {
         // prevent wrap-around on underflow making huge matrices
         static_assert(N > 0, "No more columns to remove");
-        // TODO: implement
-        return {};
+        return Matrix<T, M, N - 1, Allocator, L>(this->view().remove_col(col));
     }
 private:
     // contents
@@ -313,205 +593,611 @@ private:
 };
 
 // partial class template specialisation for SIZE_MAX-sized matrices, which are dynamic-sized
-template <typename T>
+// the cells are allocated with Allocator, which by default aligns them to a
+// cache line
+template <typename T, typename Allocator, Layout L>
 class Matrix<
     T,
     std::numeric_limits<size_t>::max(),
-    std::numeric_limits<size_t>::max()
-> : public MatrixBase<T> {
+    std::numeric_limits<size_t>::max(),
+    Allocator,
+    L
+> {
+    // for flip_layout() to hand its cells over
+    template <typename, std::size_t, std::size_t, typename, Layout>
+    friend class Matrix;
 public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    static constexpr Layout layout = L;
     // default ctor, creates dynamic Matrix of zero size (empty matrix)
     Matrix() : _m(0), _n(0) , _contents() {}
+    // creates dynamic Matrix of zero size, which will allocate with allocator
+    explicit Matrix(const Allocator& allocator) : _m(0), _n(0) , _contents(allocator) {}
     // this ctor sets Matrix size and default-initialises all elements within
-    Matrix(std::size_t m, std::size_t n) : _m(m), _n(n) , _contents(m * n) {}
+    Matrix(std::size_t m, std::size_t n, const Allocator& allocator = Allocator())
+      : _m(m)
+      , _n(n)
+      , _contents(m * n, allocator)
+      {}
     // this ctor sets Matrix size and elements from initialiser list
     Matrix(
         std::size_t m,
         std::size_t n,
-        std::initializer_list<std::initializer_list<T>> l
+        std::initializer_list<std::initializer_list<T>> l,
+        const Allocator& allocator = Allocator()
     )
       : _m(m)
       , _n(n)
-      , _contents(m * n)
+      , _contents(m * n, allocator)
       {
         // validate list dimensions
         if (l.size() != _m) {
             throw std::runtime_error("Top-level initializer_list is wrong size");
         }
         // set contents of each row one by one (we allow shortened rows)
-        MatrixBase<T>::_unpack_initializer_list(l, n, this->_contents);
+        detail::unpack_initializer_list<T, L>(l, n, this->_contents);
     }
-    // this ctor sets Matrix size and elements from dynamic-size span
-    Matrix(std::size_t m, std::size_t n, std::span<const T> s)
+    // this ctor sets Matrix size and elements from dynamic-size span, in the
+    // order of layout
+    Matrix(
+        std::size_t m,
+        std::size_t n,
+        std::span<const T> s,
+        const Allocator& allocator = Allocator()
+    )
       : _m(m)
       , _n(n)
-      , _contents()
+      , _contents(allocator)
       {
         // validate span size
         if (s.size() != m * n) {
             throw std::runtime_error("Span is wrong size");
         }
         // set contents
-        _contents = std::vector(s.begin(), s.end());
+        _contents.assign(s);
+    }
+    // this ctor initialises dynamic Matrix from a Fixed Matrix, or from a
+    // dynamic Matrix with a different allocator or layout
+    template <std::size_t P, std::size_t Q, typename A, Layout K>
+    explicit Matrix(const Matrix<T, P, Q, A, K>& other, const Allocator& allocator = Allocator())
+      : _m(other.row_count())
+      , _n(other.col_count())
+      , _contents(allocator)
+      {
+        if constexpr (K == L) {
+            _contents.assign(other.contents());
+        } else {
+            _contents = detail::CellStorage<T, Allocator>(_m * _n, allocator);
+            detail::copy_cells<L>(other, this->contents());
+        }
+    }
+    // this ctor evaluates an element-wise expression of matrices
+    template <MatrixExpression E>
+    Matrix(const E& expression, const Allocator& allocator = Allocator())
+      : _m(expression.row_count())
+      , _n(expression.col_count())
+      , _contents(_m * _n, allocator)
+      {
+        detail::evaluate<L>(expression, _contents.data(), _m * _n);
+    }
+    // evaluates an element-wise expression of matrices into this Matrix,
+    // reusing its cells when the dimensions match and the expression can't
+    // read cells of this Matrix it's already written
+    template <MatrixExpression E>
+    Matrix& operator=(const E& expression) {
+        if constexpr (E::CONTIGUOUS and E::LAYOUT == L) {
+            if (expression.row_count() == _m and expression.col_count() == _n) {
+                detail::evaluate<L>(expression, _contents.data(), _m * _n);
+                return *this;
+            }
+        }
+        return *this = Matrix(expression, get_allocator());
     }
-    // this ctor initialises dynamic Matrix from a Fixed Matrix
-    template <std::size_t P, std::size_t Q>
-    explicit Matrix(const Matrix<T, P, Q>& other) : Matrix(P, Q, other.contents()) {}
-    // vritual destructor required due to C++ language rules
-    virtual ~Matrix() = default;
     // read-only accessor for matrix contents
-    std::span<const T> contents() const override {
-        return std::span<const T>(_contents);
+    std::span<const T> contents() const {
+        return std::span<const T>(_contents.data(), _contents.size());
     }
     // read-write accessor for matrix contents
-    std::span<T> contents() override {
-        return std::span<T>(_contents);
+    std::span<T> contents() {
+        return std::span<T>(_contents.data(), _contents.size());
     }
     // getters for dimensions
-    std::size_t row_count() const override { return _m; }
-    std::size_t col_count() const override { return _n; }
-    // equality operator
-    bool operator==(const Matrix& other) const {
+    std::size_t row_count() const { return _m; }
+    std::size_t col_count() const { return _n; }
+    // get matrix dimensions as pair of <rows, columns>
+    std::pair<std::size_t, std::size_t> dimensions() const {
+        return {_m, _n};
+    }
+    // the allocator used for the cells
+    Allocator get_allocator() const {
+        return _contents.get_allocator();
+    }
+    // equality operator, with a dynamic Matrix using any allocator or layout
+    template <typename A, Layout K>
+    bool operator==(const Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, A, K>& other) const {
         // validate dimensions before doing the actual comparison
-        if (not MatrixBase<T>::dimensions_match(*this, other)) {
+        if (not detail::dimensions_match(*this, other)) {
             throw std::runtime_error("Matrix dimensions don't match");
         }
+        // cells stored in different orders are compared one by one
+        if constexpr (K != L) {
+            for (std::size_t m = 0; m < _m; m++) {
+                for (std::size_t n = 0; n < _n; n++) {
+                    if ((*this)(m, n) != other(m, n)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
         // otherwise, just compare contents
-        return this->_contents == other._contents;
+        auto cells = other.contents();
+        if constexpr (detail::simd::is_vectorisable_v<T>) {
+            return detail::simd::equal(_contents.data(), cells.data(), _contents.size());
+        }
+        return std::equal(_contents.begin(), _contents.end(), cells.begin());
     }
-    // read-only accessor for a specific cell of the Matrix
-    const T& operator()(std::size_t m, std::size_t n) const override {
+    // read-only view of the whole Matrix
+    MatrixView<const T> view() const {
+        return MatrixView<const T>(
+            _contents.data(), _m, _n, detail::row_stride<L>(_m, _n), detail::col_stride<L>(_m, _n)
+        );
+    }
+    // read-write view of the whole Matrix
+    MatrixView<T> view() {
+        return MatrixView<T>(
+            _contents.data(), _m, _n, detail::row_stride<L>(_m, _n), detail::col_stride<L>(_m, _n)
+        );
+    }
+    // read-only accessor for a specific cell of the Matrix, bounds-checked
+    const T& at(std::size_t m, std::size_t n) const {
         // validate indices
         if (m >= _m or n >= _n) {
             throw std::runtime_error("Matrix[] indices out of bounds");
         }
-        return _contents[m * _n + n];
+        return _contents[detail::cell_index<L>(m, n, _m, _n)];
     }
-    // read-write accessor for a specific cell of the Matrix
-    T& operator()(std::size_t m, std::size_t n) override {
+    // read-write accessor for a specific cell of the Matrix, bounds-checked
+    T& at(std::size_t m, std::size_t n) {
         // validate indices
         if (m >= _m or n >= _n) {
             throw std::runtime_error("Matrix[] indices out of bounds");
         }
-        return _contents[m * _n + n];
+        return _contents[detail::cell_index<L>(m, n, _m, _n)];
+    }
+    // read-only accessor for a specific cell of the Matrix
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    const T& operator()(std::size_t m, std::size_t n) const {
+        if constexpr (GRYDE_CHECKED_CELL_ACCESS) {
+            return at(m, n);
+        } else {
+            assert(m < _m and n < _n);
+            return _contents[detail::cell_index<L>(m, n, _m, _n)];
+        }
+    }
+    // read-write accessor for a specific cell of the Matrix
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    T& operator()(std::size_t m, std::size_t n) {
+        if constexpr (GRYDE_CHECKED_CELL_ACCESS) {
+            return at(m, n);
+        } else {
+            assert(m < _m and n < _n);
+            return _contents[detail::cell_index<L>(m, n, _m, _n)];
+        }
     }
     // calculates determinant for square Matrices
+    // NOTE: the cells of either layout work, the transpose has the same one
     T determinant() const {
         // do check for square Matrix at run-time
         if (_m != _n) {
             throw std::runtime_error("Determinant is undefined for non-square Matrix");
         }
-        // rule out special cases
-        if (_m == 0) {
-            return T{1};
-        } else if (_m == 1) {
-            return this->_contents[0];
-        } else {
-            // recursively calculate determinant
-            // get the first row of values
-            std::span<const T> top_row = this->contents().subspan(0, _n);
-            // make a vector of each corresponding submatrix
-            std::vector<Matrix<T>> submatrices(_n);
-            for (std::size_t col = 0; col < _n; col++) {
-                submatrices[col] = this->submatrix(0, col);
-            }
-            // sum by adding each entry and subtracting each other entry
-            T sum = {};
-            for (std::size_t col = 0; col < _n; col++) {
-                if (col % 2 == 0) { // add when even
-                    sum += top_row[col] * submatrices[col].determinant();
-                } else { // subtract when odd
-                    sum -= top_row[col] * submatrices[col].determinant();
+        // use elimination for all but the smallest matrices where possible
+        if constexpr (std::is_floating_point_v<T>) {
+            if (_m >= detail::ELIMINATION_DETERMINANT_MIN_SIZE) {
+                // factorise a copy of the contents, determinant is product of the diagonal
+                detail::CellStorage<T> cells;
+                cells.assign(this->contents());
+                // large matrices are factorised by blocks, spread across the
+                // default pool, or by LAPACK where it's enabled
+                if (_m >= detail::LU_BLOCKED_MIN_SIZE or detail::USES_BLAS_V<T>) {
+                    return detail::lu_determinant_blocked(
+                        cells.data(), _m, detail::default_execution_pool().load()
+                    );
                 }
+                return detail::lu_determinant(cells.data(), _m);
+            }
+        } else if constexpr (detail::is_exact_integer_v<T>) {
+            if (_m >= detail::ELIMINATION_DETERMINANT_MIN_SIZE) {
+                // exact fraction-free elimination on widened copy of the contents
+                detail::CellStorage<std::intmax_t> cells(_m * _n);
+                return detail::bareiss_determinant(this->contents(), cells.data(), _m);
+            }
+        }
+        // cofactor expansion in place, without building submatrices
+        if (_m > detail::COFACTOR_DETERMINANT_MAX_SIZE) {
+            throw std::runtime_error("Matrix is too large for cofactor expansion");
+        }
+        return detail::cofactor_determinant(this->contents(), _m);
+    }
+    // calculates the inverse of square floating-point Matrices, throwing an
+    // exception if the Matrix is singular
+    // large matrices are factorised by blocks, spread across the default pool
+    // to invert the same Matrix more than once, or to solve with it, use LU
+    // NOTE: the inverse of the transpose is the transpose of the inverse, so
+    // this works on the cells of either layout
+    Matrix inverse() const {
+        static_assert(std::is_floating_point_v<T>, "Inverse is only implemented for floating-point Matrix");
+        // do check for square Matrix at run-time
+        if (_m != _n) {
+            throw std::runtime_error("Inverse is undefined for non-square Matrix");
+        }
+        ThreadPool* pool = detail::default_execution_pool().load();
+        detail::CellStorage<T> cells;
+        cells.assign(this->contents());
+        std::vector<std::size_t> pivots(_m);
+        detail::lu_factorise_blocked(cells.data(), _m, pivots.data(), pool);
+        for (std::size_t k = 0; k < _m; k++) {
+            if (cells[k * _m + k] == T{}) {
+                throw std::runtime_error("Matrix is singular");
             }
-            return sum;
+        }
+        // solve for the columns of the identity
+        Matrix inverse(_m, _n, get_allocator());
+        for (std::size_t k = 0; k < _m; k++) {
+            inverse._contents[k * _n + k] = T{1};
+        }
+        detail::lu_solve_blocked(cells.data(), _m, pivots.data(), inverse._contents.data(), _n, pool);
+        return inverse;
+    }
+    // calculates rank, the number of linearly independent rows or columns
+    std::size_t rank() const {
+        // as for determinant(), the layout doesn't matter
+        static_assert(
+            std::is_floating_point_v<T> or detail::is_exact_integer_v<T>,
+            "Rank is only implemented for floating-point or integer Matrix"
+        );
+        if constexpr (std::is_floating_point_v<T>) {
+            detail::CellStorage<T> cells;
+            cells.assign(this->contents());
+            return detail::lu_rank(cells.data(), _m, _n);
+        } else {
+            detail::CellStorage<std::intmax_t> cells(_m * _n);
+            return detail::bareiss_rank(this->contents(), cells.data(), _m, _n);
         }
     }
-    // dynamic-Matrix + dynamic-Matrix
-    Matrix operator+(const Matrix& other) const {
+    // dynamic-Matrix * dynamic-Matrix
+    Matrix operator*(const Matrix& other) const {
         // validate dimensions
-        if (not MatrixBase<T>::dimensions_match(*this, other)) {
-            throw std::runtime_error("Matrix dimensions don't match");
+        if (not detail::dimensions_compatible(*this, other)) {
+            throw std::runtime_error("Matrix dimensions are incompatible for multiplication");
         }
-        Matrix result(_m, _n);
-        MatrixBase<T>::_element_wise_addition(*this, other, result);
-        return result;
+        Matrix output(_m, other._n, get_allocator());
+        detail::matrix_multiplication(*this, other, output, detail::default_execution_pool().load());
+        return output;
     }
-    // dynamic-Matrix + fixed-Matrix
-    template <std::size_t P, std::size_t Q>
-    Matrix<T, P, Q> operator+(const Matrix<T, P, Q>& other) const {
+    // dynamic-Matrix * fixed-Matrix, or dynamic-Matrix with a different
+    // allocator or layout, the product has the layout of this one
+    template <std::size_t P, std::size_t Q, typename A, Layout K>
+    Matrix operator*(const Matrix<T, P, Q, A, K>& other) const {
         // validate dimensions
-        if (not MatrixBase<T>::dimensions_match(*this, other)) {
-            throw std::runtime_error("Matrix dimensions don't match");
+        if (not detail::dimensions_compatible(*this, other)) {
+            throw std::runtime_error("Matrix dimensions are incompatible for multiplication");
         }
-        Matrix<T, P, Q> result;
-        MatrixBase<T>::_element_wise_addition(*this, other, result);
-        return result;
+        Matrix output(_m, other.col_count(), get_allocator());
+        detail::matrix_multiplication(*this, other, output, detail::default_execution_pool().load());
+        return output;
     }
-    // dynamic-Matrix * scalar
-    Matrix operator*(const T& scalar) const {
-        // TODO: implement scalar multiplication
-        return {};
+    // dynamic-Matrix transposition, with the same layout
+    Matrix transpose() const {
+        return Matrix(this->view().transpose(), get_allocator());
     }
-    // dynamic-Matrix * dynamic-Matrix
-    Matrix operator*(const Matrix& other) const {
-        // TODO: validate compatible dimensions at run-time? (or just relegate check to casting constructor?)
-            // TODO: implement Matrix multiplication
-            return {};
-        }
-        // dynamic-Matrix * fixed-Matrix
-        template <std::size_t P, std::size_t Q>
-        Matrix operator*(const Matrix<T, P, Q>& other) const {
-            // TODO: validate compatible dimensions at run-time? (or just relegate check to casting constructor?)
-            // TODO: implement Matrix multiplication
-            return {};
-        }
-        // dynamic-Matrix transposition
-        Matrix transpose() const {
-            // TODO: implement transposition
-            return {};
-        }
-        // returns a new dynamic-Matrix with the specified row and column removed
-        Matrix submatrix(std::size_t row, std::size_t col) const {
-            // prevent wrap-around on underflow making huge matrices
-            if (_m < 1 or _n < 1) {
-                throw std::runtime_error("No more rows or columns to remove");
-            }
-            // validate row and column indices
-            if (row >= _m or col >= _n) {
-                throw std::runtime_error("Row or column index out of bounds");
-            }
+    // the transpose, without moving any cells: the cells of this Matrix in
+    // one layout are those of its transpose in the other one
+    Matrix<
+        T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, Allocator, detail::opposite_layout(L)
+    > flip_layout() const& {
+        return {_n, _m, this->contents(), get_allocator()};
+    }
+    // as above, but taking the cells of an expiring Matrix instead of copying
+    // them, which leaves it empty
+    Matrix<
+        T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, Allocator, detail::opposite_layout(L)
+    > flip_layout() && {
+        Matrix<
+            T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, Allocator, detail::opposite_layout(L)
+        > flipped(_n, _m, std::move(_contents));
+        _m = 0;
+        _n = 0;
+        return flipped;
+    }
+    // returns a new dynamic-Matrix with the specified row and column removed
+    Matrix submatrix(std::size_t row, std::size_t col) const {
+        // prevent wrap-around on underflow making huge matrices
+        if (_m < 1 or _n < 1) {
+            throw std::runtime_error("No more rows or columns to remove");
+        }
+        // validate row and column indices
+        if (row >= _m or col >= _n) {
+            throw std::runtime_error("Row or column index out of bounds");
+        }
 
-            // make a smaller matrix
-            Matrix sub(_m - 1, _n - 1);
-            // populate it from all cells except those from the removed row and column
-            this->_populate_submatrix(sub, row, col);
-            return sub;
-        }
-        // returns a new dynamic-Matrix with the specified row removed
-        Matrix remove_row(std::size_t row) const {
-            // prevent wrap-around on underflow making huge matrices
-            if (_m < 1) {
-                throw std::runtime_error("No more rows to remove");
-            }
-            // TODO: implement
-            return Matrix(_m - 1, _n); // reduce size
-        }
-        // returns a new dynamic-Matrix with the specified column removed
-        Matrix remove_col(std::size_t col) const {
-            // prevent wrap-around on underflow making huge matrices
-            if (_n < 1) {
-                throw std::runtime_error("No more columns to remove");
-            }
-            // TODO: implement
-            return Matrix(_m, _n - 1); // reduce size
-        }
-    private:
-        // dimensions
-        std::size_t _m;
-        std::size_t _n;
-        // contents
-        std::vector<T> _contents;
-    };
+        // make a smaller matrix
+        Matrix sub(_m - 1, _n - 1, get_allocator());
+        // populate it from all cells except those from the removed row and column
+        detail::populate_submatrix(*this, sub, row, col);
+        return sub;
+    }
+    // returns a new dynamic-Matrix with the specified row removed
+    Matrix remove_row(std::size_t row) const {
+        // prevent wrap-around on underflow making huge matrices
+        if (_m < 1) {
+            throw std::runtime_error("No more rows to remove");
+        }
+        return Matrix(this->view().remove_row(row), get_allocator());
+    }
+    // returns a new dynamic-Matrix with the specified column removed
+    Matrix remove_col(std::size_t col) const {
+        // prevent wrap-around on underflow making huge matrices
+        if (_n < 1) {
+            throw std::runtime_error("No more columns to remove");
+        }
+        return Matrix(this->view().remove_col(col), get_allocator());
+    }
+private:
+    // takes over cells which are already in the order of layout
+    Matrix(std::size_t m, std::size_t n, detail::CellStorage<T, Allocator>&& contents)
+      : _m(m)
+      , _n(n)
+      , _contents(std::move(contents))
+      {}
+    // dimensions
+    std::size_t _m;
+    std::size_t _n;
+    // contents
+    // kept inline for small matrices, otherwise allocated with Allocator
+    detail::CellStorage<T, Allocator> _contents;
+};
+
+namespace pmr {
+    // dynamic-size Matrix with its cells allocated from a memory resource, so
+    // that short-lived matrices can come from an arena and be freed together
+    // NOTE: cells are only aligned as T requires, not to a cache line
+    template <typename T>
+    using Matrix = gryde::Matrix<
+        T,
+        std::numeric_limits<size_t>::max(),
+        std::numeric_limits<size_t>::max(),
+        std::pmr::polymorphic_allocator<T>
+    >;
+} // namespace pmr
+
+// Matrix with its cells stored column by column, as BLAS and LAPACK expect
+template <
+    typename T,
+    std::size_t M = std::numeric_limits<size_t>::max(),
+    std::size_t N = std::numeric_limits<size_t>::max(),
+    typename Allocator = AlignedAllocator<T>
+>
+using ColumnMajorMatrix = Matrix<T, M, N, Allocator, Layout::COLUMN_MAJOR>;
+
+// opt-in type-erased wrapper, owns a Matrix of any kind and exposes it through
+// the virtual MatrixBase interface, e.g. for heterogeneous containers
+template <WritableMatrixLike MatrixType>
+class PolymorphicMatrix : public MatrixBase<typename MatrixType::value_type> {
+public:
+    using value_type = typename MatrixType::value_type;
+    static constexpr Layout layout = detail::layout_of_v<MatrixType>;
+    // wraps a copy of a Matrix
+    constexpr PolymorphicMatrix(const MatrixType& matrix) : _matrix(matrix) {}
+    // wraps a Matrix by moving it in
+    constexpr PolymorphicMatrix(MatrixType&& matrix) : _matrix(std::move(matrix)) {}
+    // getters for dimensions
+    constexpr std::size_t row_count() const override { return _matrix.row_count(); }
+    constexpr std::size_t col_count() const override { return _matrix.col_count(); }
+    // read-only accessor for matrix contents
+    constexpr std::span<const value_type> contents() const override { return _matrix.contents(); }
+    // read-write accessor for matrix contents
+    constexpr std::span<value_type> contents() override { return _matrix.contents(); }
+    // read-only accessor for a specific cell of the Matrix
+    constexpr const value_type& operator()(std::size_t m, std::size_t n) const override {
+        return _matrix(m, n);
+    }
+    // read-write accessor for a specific cell of the Matrix
+    constexpr value_type& operator()(std::size_t m, std::size_t n) override {
+        return _matrix(m, n);
+    }
+    // access to the wrapped Matrix
+    constexpr const MatrixType& matrix() const { return _matrix; }
+    constexpr MatrixType& matrix() { return _matrix; }
+private:
+    MatrixType _matrix;
+};
+
+namespace detail {
+    // wraps a Matrix as the leaf of an expression
+    template <typename T, std::size_t M, std::size_t N, typename Allocator, Layout L>
+    constexpr CellsExpression<T, M, N, L> as_expression(const Matrix<T, M, N, Allocator, L>& matrix) {
+        return {matrix.contents(), matrix.row_count(), matrix.col_count()};
+    }
+    // expressions are already expressions
+    template <MatrixExpression E>
+    constexpr const E& as_expression(const E& expression) {
+        return expression;
+    }
+    // anything that can be an operand of an element-wise operation
+    template <typename X>
+    concept ElementWiseOperand = requires(const X& x) { as_expression(x); };
+    // the expression type that an operand is used as
+    template <ElementWiseOperand X>
+    using expression_t = std::remove_cvref_t<decltype(as_expression(std::declval<const X&>()))>;
+    // builds a BinaryExpression from any two operands
+    template <typename Op, ElementWiseOperand L, ElementWiseOperand R>
+    constexpr BinaryExpression<Op, expression_t<L>, expression_t<R>> make_binary_expression(
+        const L& lhs,
+        const R& rhs
+    ) {
+        return {as_expression(lhs), as_expression(rhs)};
+    }
+} // namespace detail
+
+// Matrix + Matrix, of any combination of fixed, dynamic or expression
+template <detail::ElementWiseOperand L, detail::ElementWiseOperand R>
+constexpr auto operator+(const L& lhs, const R& rhs) {
+    return detail::make_binary_expression<std::plus<>>(lhs, rhs);
+}
+
+// Matrix - Matrix, of any combination of fixed, dynamic or expression
+template <detail::ElementWiseOperand L, detail::ElementWiseOperand R>
+constexpr auto operator-(const L& lhs, const R& rhs) {
+    return detail::make_binary_expression<std::minus<>>(lhs, rhs);
+}
+
+// element-wise (Hadamard) product of two matrices of the same dimensions
+template <detail::ElementWiseOperand L, detail::ElementWiseOperand R>
+constexpr auto hadamard_product(const L& lhs, const R& rhs) {
+    return detail::make_binary_expression<std::multiplies<>>(lhs, rhs);
+}
+
+// Matrix * scalar
+template <detail::ElementWiseOperand E>
+constexpr auto operator*(const E& lhs, const typename detail::expression_t<E>::value_type& scalar) {
+    return ScalarExpression<detail::MultiplyByScalar, detail::expression_t<E>>(
+        detail::as_expression(lhs),
+        scalar
+    );
+}
+
+// scalar * Matrix
+template <detail::ElementWiseOperand E>
+constexpr auto operator*(const typename detail::expression_t<E>::value_type& scalar, const E& rhs) {
+    return ScalarExpression<detail::ScalarMultiplyBy, detail::expression_t<E>>(
+        detail::as_expression(rhs),
+        scalar
+    );
+}
+
+// Matrix += Matrix, for any operand of the same dimensions, in place
+template <typename T, std::size_t M, std::size_t N, typename A, Layout L, detail::ElementWiseOperand R>
+constexpr Matrix<T, M, N, A, L>& operator+=(Matrix<T, M, N, A, L>& lhs, const R& rhs) {
+    return lhs = detail::make_binary_expression<std::plus<>>(lhs, rhs);
+}
+
+// Matrix -= Matrix, for any operand of the same dimensions, in place
+template <typename T, std::size_t M, std::size_t N, typename A, Layout L, detail::ElementWiseOperand R>
+constexpr Matrix<T, M, N, A, L>& operator-=(Matrix<T, M, N, A, L>& lhs, const R& rhs) {
+    return lhs = detail::make_binary_expression<std::minus<>>(lhs, rhs);
+}
+
+// Matrix *= scalar, in place
+template <typename T, std::size_t M, std::size_t N, typename A, Layout L>
+constexpr Matrix<T, M, N, A, L>& operator*=(Matrix<T, M, N, A, L>& lhs, const std::type_identity_t<T>& scalar) {
+    return lhs = lhs * scalar;
+}
+
+// Matrix *= Matrix, the product must have the same dimensions as lhs
+template <typename T, std::size_t M, std::size_t N, typename A, Layout L, detail::MultiplicationOperand R>
+constexpr Matrix<T, M, N, A, L>& operator*=(Matrix<T, M, N, A, L>& lhs, const R& rhs) {
+    return lhs = Matrix<T, M, N, A, L>(lhs * rhs);
+}
+
+// the following overloads take an expiring Matrix operand and write the
+// result into its cells instead of into a new Matrix, so chains like
+// a * b + c + d only allocate for a * b
+
+// expiring Matrix + Matrix
+template <typename T, std::size_t M, std::size_t N, typename A, Layout L, detail::ElementWiseOperand R>
+constexpr Matrix<T, M, N, A, L> operator+(Matrix<T, M, N, A, L>&& lhs, const R& rhs) {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+// Matrix + expiring Matrix
+template <detail::ElementWiseOperand L, typename T, std::size_t M, std::size_t N, typename A, Layout K>
+constexpr Matrix<T, M, N, A, K> operator+(const L& lhs, Matrix<T, M, N, A, K>&& rhs) {
+    rhs = detail::make_binary_expression<std::plus<>>(lhs, rhs);
+    return std::move(rhs);
+}
+
+// expiring Matrix + expiring Matrix
+template <
+    typename T, std::size_t M, std::size_t N, typename A, Layout L,
+    std::size_t P, std::size_t Q, typename B, Layout K
+>
+constexpr Matrix<T, M, N, A, L> operator+(Matrix<T, M, N, A, L>&& lhs, Matrix<T, P, Q, B, K>&& rhs) {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+// expiring Matrix - Matrix
+template <typename T, std::size_t M, std::size_t N, typename A, Layout L, detail::ElementWiseOperand R>
+constexpr Matrix<T, M, N, A, L> operator-(Matrix<T, M, N, A, L>&& lhs, const R& rhs) {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+// Matrix - expiring Matrix
+template <detail::ElementWiseOperand L, typename T, std::size_t M, std::size_t N, typename A, Layout K>
+constexpr Matrix<T, M, N, A, K> operator-(const L& lhs, Matrix<T, M, N, A, K>&& rhs) {
+    rhs = detail::make_binary_expression<std::minus<>>(lhs, rhs);
+    return std::move(rhs);
+}
+
+// expiring Matrix - expiring Matrix
+template <
+    typename T, std::size_t M, std::size_t N, typename A, Layout L,
+    std::size_t P, std::size_t Q, typename B, Layout K
+>
+constexpr Matrix<T, M, N, A, L> operator-(Matrix<T, M, N, A, L>&& lhs, Matrix<T, P, Q, B, K>&& rhs) {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+// expiring Matrix * scalar
+template <typename T, std::size_t M, std::size_t N, typename A, Layout L>
+constexpr Matrix<T, M, N, A, L> operator*(Matrix<T, M, N, A, L>&& lhs, const std::type_identity_t<T>& scalar) {
+    lhs *= scalar;
+    return std::move(lhs);
+}
+
+// scalar * expiring Matrix
+template <typename T, std::size_t M, std::size_t N, typename A, Layout L>
+constexpr Matrix<T, M, N, A, L> operator*(const std::type_identity_t<T>& scalar, Matrix<T, M, N, A, L>&& rhs) {
+    rhs = scalar * rhs;
+    return std::move(rhs);
+}
+
+// Matrix * Matrix for any kinds of Matrix or MatrixView, giving a dynamic
+// Matrix, run with the given execution policy
+template <
+    execution::ExecutionPolicy Policy,
+    detail::MultiplicationOperand L,
+    detail::MultiplicationOperand R
+>
+Matrix<typename L::value_type> multiply(const Policy& policy, const L& lhs, const R& rhs) {
+    static_assert(
+        std::is_same_v<typename L::value_type, typename R::value_type>,
+        "Matrix element types don't match"
+    );
+    // validate dimensions
+    if (not detail::dimensions_compatible(lhs, rhs)) {
+        throw std::runtime_error("Matrix dimensions are incompatible for multiplication");
+    }
+    Matrix<typename L::value_type> output(lhs.row_count(), rhs.col_count());
+    detail::matrix_multiplication(lhs, rhs, output, detail::execution_pool(policy));
+    return output;
+}
+
+// Matrix * Matrix where either operand is a MatrixView, giving a dynamic Matrix
+template <detail::MultiplicationOperand L, detail::MultiplicationOperand R>
+requires (detail::is_matrix_view_v<L> or detail::is_matrix_view_v<R>)
+Matrix<typename L::value_type> operator*(const L& lhs, const R& rhs) {
+    ThreadPool* pool = detail::default_execution_pool().load();
+    if (pool != nullptr) {
+        return multiply(execution::par.on(*pool), lhs, rhs);
+    }
+    return multiply(execution::seq, lhs, rhs);
+}
 } // namespace com::saxbophone::gryde
 #endif // include guard
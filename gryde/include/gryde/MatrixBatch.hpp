@@ -0,0 +1,309 @@
+#ifndef COM_SAXBOPHONE_GRYDE_MATRIX_BATCH_HPP
+#define COM_SAXBOPHONE_GRYDE_MATRIX_BATCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+
+#include <gryde/AlignedAllocator.hpp>
+#include <gryde/Batch.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/detail/Batch.hpp>
+#include <gryde/detail/Simd.hpp>
+
+namespace com::saxbophone::gryde {
+// a batch of fixed-size M * N matrices, stored structure-of-arrays: each cell
+// (m, n) of every Matrix in the batch is stored together, so that arithmetic
+// on the batch is vectorised across the matrices in it
+// the whole batch is one allocation from Allocator, rather than one array of
+// cells per Matrix
+template <typename T, std::size_t M, std::size_t N, typename Allocator = AlignedAllocator<T>>
+class MatrixBatch {
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using matrix_type = Matrix<T, M, N>;
+    // creates an empty batch
+    MatrixBatch() : _size(0), _cells() {}
+    // creates a batch of count default-initialised matrices
+    explicit MatrixBatch(std::size_t count, const Allocator& allocator = Allocator())
+      : _size(count)
+      , _cells(M * N * count, allocator)
+      {}
+    // creates a batch holding copies of the given matrices
+    MatrixBatch(std::span<const matrix_type> matrices, const Allocator& allocator = Allocator())
+      : MatrixBatch(matrices.size(), allocator)
+      {
+        for (std::size_t i = 0; i < _size; i++) {
+            set(i, matrices[i]);
+        }
+    }
+    // creates a batch holding copies of the given matrices
+    MatrixBatch(std::initializer_list<matrix_type> matrices, const Allocator& allocator = Allocator())
+      : MatrixBatch(std::span<const matrix_type>(matrices.begin(), matrices.size()), allocator)
+      {}
+    // number of matrices in the batch
+    std::size_t size() const { return _size; }
+    // number of rows of each Matrix
+    constexpr std::size_t row_count() const { return M; }
+    // number of columns of each Matrix
+    constexpr std::size_t col_count() const { return N; }
+    allocator_type get_allocator() const { return _cells.get_allocator(); }
+    // equality operator
+    bool operator==(const MatrixBatch& other) const {
+        if (_size != other._size) {
+            return false;
+        }
+        if constexpr (detail::simd::is_vectorisable_v<T>) {
+            return detail::simd::equal(_cells.data(), other._cells.data(), _cells.size());
+        } else {
+            return std::equal(_cells.begin(), _cells.end(), other._cells.begin());
+        }
+    }
+    // read-only accessor for cell (m, n) of every Matrix in the batch
+    std::span<const T> cells(std::size_t m, std::size_t n) const {
+        if (m >= M or n >= N) {
+            throw std::runtime_error("Matrix[] indices out of bounds");
+        }
+        return std::span<const T>(_cells.data() + (m * N + n) * _size, _size);
+    }
+    // read-write accessor for cell (m, n) of every Matrix in the batch
+    std::span<T> cells(std::size_t m, std::size_t n) {
+        if (m >= M or n >= N) {
+            throw std::runtime_error("Matrix[] indices out of bounds");
+        }
+        return std::span<T>(_cells.data() + (m * N + n) * _size, _size);
+    }
+    // read-only accessor for cell (m, n) of Matrix i, bounds-checked
+    const T& at(std::size_t i, std::size_t m, std::size_t n) const {
+        _check_indices(i, m, n);
+        return _cells[(m * N + n) * _size + i];
+    }
+    // read-write accessor for cell (m, n) of Matrix i, bounds-checked
+    T& at(std::size_t i, std::size_t m, std::size_t n) {
+        _check_indices(i, m, n);
+        return _cells[(m * N + n) * _size + i];
+    }
+    // read-only accessor for cell (m, n) of Matrix i
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    const T& operator()(std::size_t i, std::size_t m, std::size_t n) const {
+        if constexpr (GRYDE_CHECKED_CELL_ACCESS) {
+            return at(i, m, n);
+        } else {
+            assert(i < _size and m < M and n < N);
+            return _cells[(m * N + n) * _size + i];
+        }
+    }
+    // read-write accessor for cell (m, n) of Matrix i
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    T& operator()(std::size_t i, std::size_t m, std::size_t n) {
+        if constexpr (GRYDE_CHECKED_CELL_ACCESS) {
+            return at(i, m, n);
+        } else {
+            assert(i < _size and m < M and n < N);
+            return _cells[(m * N + n) * _size + i];
+        }
+    }
+    // copy of Matrix i
+    matrix_type get(std::size_t i) const {
+        if (i >= _size) {
+            throw std::runtime_error("Batch index out of bounds");
+        }
+        matrix_type matrix;
+        auto contents = matrix.contents();
+        for (std::size_t c = 0; c < M * N; c++) {
+            contents[c] = _cells[c * _size + i];
+        }
+        return matrix;
+    }
+    // replaces Matrix i with a copy of the given Matrix
+    void set(std::size_t i, const matrix_type& matrix) {
+        if (i >= _size) {
+            throw std::runtime_error("Batch index out of bounds");
+        }
+        auto contents = matrix.contents();
+        for (std::size_t c = 0; c < M * N; c++) {
+            _cells[c * _size + i] = contents[c];
+        }
+    }
+    // copies of all the matrices in the batch
+    std::vector<matrix_type> matrices() const {
+        std::vector<matrix_type> matrices(_size);
+        for (std::size_t i = 0; i < _size; i++) {
+            matrices[i] = get(i);
+        }
+        return matrices;
+    }
+    // element-wise sum of each pair of matrices
+    MatrixBatch operator+(const MatrixBatch& other) const {
+        return _transform<detail::simd::Operation::ADD>(&other, T{});
+    }
+    // element-wise difference of each pair of matrices
+    MatrixBatch operator-(const MatrixBatch& other) const {
+        return _transform<detail::simd::Operation::SUBTRACT>(&other, T{});
+    }
+    // every Matrix multiplied by a scalar
+    MatrixBatch operator*(const T& scalar) const {
+        return _transform<detail::simd::Operation::SCALE>(nullptr, scalar);
+    }
+    // product of each pair of matrices
+    template <std::size_t P>
+    MatrixBatch<T, M, P, Allocator> operator*(const MatrixBatch<T, N, P, Allocator>& other) const {
+        detail::check_batch_sizes(_size, other.size());
+        MatrixBatch<T, M, P, Allocator> product(_size, get_allocator());
+        _apply<detail::BatchOperation::MULTIPLY, P>(other.data(), product.data());
+        return product;
+    }
+    // transposes of every Matrix
+    MatrixBatch<T, N, M, Allocator> transpose() const {
+        MatrixBatch<T, N, M, Allocator> transposed(_size, get_allocator());
+        // cells of the batch only need to be moved around whole
+        for (std::size_t m = 0; m < M; m++) {
+            for (std::size_t n = 0; n < N; n++) {
+                std::ranges::copy(cells(m, n), transposed.cells(n, m).begin());
+            }
+        }
+        return transposed;
+    }
+    // determinants of every Matrix
+    std::vector<T> determinants() const {
+        static_assert(M == N, "Determinant is undefined for non-square Matrix");
+        std::vector<T> determinants(_size);
+        _apply<detail::BatchOperation::DETERMINANT, M>(nullptr, determinants.data());
+        return determinants;
+    }
+    // inverses of every Matrix, throws an exception if any of them are singular
+    MatrixBatch inverse() const {
+        static_assert(M == N, "Inverse is undefined for non-square Matrix");
+        static_assert(std::is_floating_point_v<T>, "Inverse is only implemented for floating-point Matrix");
+        MatrixBatch inverse(_size, get_allocator());
+        _apply<detail::BatchOperation::INVERSE, M>(nullptr, inverse.data());
+        return inverse;
+    }
+    // all the cells of the batch, cell (m, n) of Matrix i is at
+    // (m * N + n) * size() + i
+    const T* data() const { return _cells.data(); }
+    T* data() { return _cells.data(); }
+private:
+    void _check_indices(std::size_t i, std::size_t m, std::size_t n) const {
+        if (i >= _size) {
+            throw std::runtime_error("Batch index out of bounds");
+        }
+        if (m >= M or n >= N) {
+            throw std::runtime_error("Matrix[] indices out of bounds");
+        }
+    }
+
+    // whether all the cells of Matrix i are small enough for
+    // detail::cofactor_determinant_bound()
+    bool _is_within_cofactor_bound(std::size_t i) const {
+        for (std::size_t c = 0; c < M * N; c++) {
+            if (not detail::is_within_cofactor_bound<M>(_cells[c * _size + i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // element-wise arithmetic is the same for every cell of every Matrix, so
+    // it works on the whole batch at once
+    template <detail::simd::Operation OP>
+    MatrixBatch _transform(const MatrixBatch* other, const T& scalar) const {
+        if (other != nullptr) {
+            detail::check_batch_sizes(_size, other->_size);
+        }
+        MatrixBatch result(_size, get_allocator());
+        const T* b = other != nullptr ? other->_cells.data() : nullptr;
+        if constexpr (detail::simd::is_vectorisable_v<T>) {
+            detail::simd::transform<OP>(_cells.data(), b, scalar, result._cells.data(), _cells.size());
+        } else {
+            detail::simd::transform_scalar<OP>(_cells.data(), b, scalar, result._cells.data(), _cells.size());
+        }
+        return result;
+    }
+
+    // applies OP to every Matrix (and the matching Matrix of b, which has N * P
+    // cells), writing the results to out, in the same layout
+    // spread across the default execution pool, if there is one
+    template <detail::BatchOperation OP, std::size_t P>
+    void _apply(const T* b, T* out) const {
+        constexpr std::size_t RESULT_CELLS = detail::BATCH_RESULT_CELLS<OP, M, P>;
+        const std::size_t stride = _size;
+        const detail::simd::Isa isa = detail::simd::active_isa();
+        detail::batch_for(detail::default_execution_pool().load(), _size, [&](std::size_t begin, std::size_t end) {
+            if constexpr (detail::is_batch_vectorised_v<OP, M, N, P>) {
+                // checked integer determinants are only vectorised for runs of
+                // matrices with cells too small to overflow, others are done
+                // one at a time by Matrix::determinant() so that they throw
+                // the same way
+                constexpr bool CHECKED = OP == detail::BatchOperation::DETERMINANT and detail::is_checked_determinant_v<T, M>;
+                std::size_t run = begin;
+                if constexpr (CHECKED) {
+                    for (std::size_t i = begin; i < end; i++) {
+                        if (not _is_within_cofactor_bound(i)) {
+                            detail::batch_cells<OP, M, N, P>(
+                                isa, _cells.data() + run, stride, b, stride, out + run, stride, i - run
+                            );
+                            out[i] = get(i).determinant();
+                            run = i + 1;
+                        }
+                    }
+                }
+                detail::batch_cells<OP, M, N, P>(
+                    isa,
+                    _cells.data() + run, stride,
+                    OP == detail::BatchOperation::MULTIPLY ? b + run : b, stride,
+                    out + run, stride,
+                    end - run
+                );
+            } else {
+                // too large to vectorise across the batch, one Matrix at a time
+                for (std::size_t i = begin; i < end; i++) {
+                    matrix_type matrix = get(i);
+                    if constexpr (OP == detail::BatchOperation::MULTIPLY) {
+                        Matrix<T, N, P> other;
+                        auto contents = other.contents();
+                        for (std::size_t c = 0; c < N * P; c++) {
+                            contents[c] = b[c * stride + i];
+                        }
+                        Matrix<T, M, P> product = matrix * other;
+                        for (std::size_t c = 0; c < RESULT_CELLS; c++) {
+                            out[c * stride + i] = product.contents()[c];
+                        }
+                    } else if constexpr (OP == detail::BatchOperation::DETERMINANT) {
+                        out[i] = matrix.determinant();
+                    } else {
+                        matrix_type inverse;
+                        std::array<std::size_t, M> pivots;
+                        if (not detail::lu_inverse(matrix.contents().data(), M, pivots.data(), inverse.contents().data())) {
+                            throw std::runtime_error("Matrix is singular");
+                        }
+                        for (std::size_t c = 0; c < RESULT_CELLS; c++) {
+                            out[c * stride + i] = inverse.contents()[c];
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    // number of matrices
+    std::size_t _size;
+    // cell (m, n) of Matrix i is at (m * N + n) * _size + i
+    std::vector<T, Allocator> _cells;
+};
+
+// every Matrix multiplied by a scalar
+template <typename T, std::size_t M, std::size_t N, typename A>
+MatrixBatch<T, M, N, A> operator*(const std::type_identity_t<T>& scalar, const MatrixBatch<T, M, N, A>& batch) {
+    return batch * scalar;
+}
+} // namespace com::saxbophone::gryde
+#endif // include guard
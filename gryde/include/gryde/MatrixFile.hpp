@@ -0,0 +1,309 @@
+#ifndef COM_SAXBOPHONE_GRYDE_MATRIX_FILE_HPP
+#define COM_SAXBOPHONE_GRYDE_MATRIX_FILE_HPP
+
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <gryde/AlignedAllocator.hpp>
+#include <gryde/Layout.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/MatrixView.hpp>
+#include <gryde/detail/FileMapping.hpp>
+
+// gryde's binary Matrix file format, which is a fixed-size header followed by
+// the cells exactly as they're stored in memory, so that they can be used
+// straight from a mapping of the file without parsing or copying them
+namespace com::saxbophone::gryde {
+// the version of the file format written, and the only one read
+inline constexpr std::uint32_t MATRIX_FILE_VERSION = 1;
+// cells are written this far apart from the start of the file by default
+inline constexpr std::size_t MATRIX_FILE_ALIGNMENT = CACHE_LINE_SIZE;
+
+namespace detail {
+    // the kinds of element type
+    enum class CellKind : std::uint8_t {
+        SIGNED_INTEGER,
+        UNSIGNED_INTEGER,
+        FLOATING_POINT,
+    };
+
+    // element types which can be stored in a Matrix file
+    template <typename T>
+    concept MatrixFileCell = std::is_arithmetic_v<T> and not std::is_same_v<T, bool>;
+
+    template <MatrixFileCell T>
+    inline constexpr CellKind cell_kind_v =
+        std::is_floating_point_v<T> ? CellKind::FLOATING_POINT :
+        std::is_signed_v<T> ? CellKind::SIGNED_INTEGER :
+        CellKind::UNSIGNED_INTEGER;
+
+    // written in native byte order, so that files from a machine with the
+    // other byte order are detected
+    inline constexpr std::uint32_t MATRIX_FILE_BYTE_ORDER = 0x01020304;
+
+    // the header at the start of a Matrix file, all fields are native-endian
+    struct MatrixFileHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byte_order;
+        CellKind kind;
+        std::uint8_t cell_size;
+        // a Layout
+        std::uint8_t layout;
+        std::uint8_t reserved[5];
+        std::uint64_t rows;
+        std::uint64_t cols;
+        // alignment of the cells, which is a power of two
+        std::uint64_t alignment;
+        // distance of the first cell from the start of the file
+        std::uint64_t cells_offset;
+        std::uint64_t reserved_too;
+    };
+    static_assert(sizeof(MatrixFileHeader) == 64, "Matrix file header must be 64 bytes");
+
+    inline constexpr char MATRIX_FILE_MAGIC[8] = {'G', 'R', 'Y', 'D', 'E', 'M', 'A', 'T',};
+
+    // checks that header describes a file of file_size bytes holding cells
+    // of type T stored with layout L, and returns the number of cells
+    template <MatrixFileCell T, Layout L>
+    std::size_t check_matrix_file_header(const MatrixFileHeader& header, std::size_t file_size) {
+        if (std::memcmp(header.magic, MATRIX_FILE_MAGIC, sizeof(MATRIX_FILE_MAGIC)) != 0) {
+            throw std::runtime_error("Matrix file is not a gryde Matrix file");
+        }
+        if (header.version != MATRIX_FILE_VERSION) {
+            throw std::runtime_error("Matrix file version is unsupported");
+        }
+        if (header.byte_order != MATRIX_FILE_BYTE_ORDER) {
+            throw std::runtime_error("Matrix file has the wrong byte order");
+        }
+        if (header.kind != cell_kind_v<T> or header.cell_size != sizeof(T)) {
+            throw std::runtime_error("Matrix file element type doesn't match");
+        }
+        if (header.layout != static_cast<std::uint8_t>(L)) {
+            throw std::runtime_error("Matrix file layout doesn't match");
+        }
+        // guard against sizes which overflow
+        const std::uint64_t max_cells = std::numeric_limits<std::size_t>::max() / sizeof(T);
+        if (header.cols != 0 and header.rows > max_cells / header.cols) {
+            throw std::runtime_error("Matrix file is truncated");
+        }
+        const std::uint64_t cells = header.rows * header.cols;
+        if (
+            header.cells_offset < sizeof(MatrixFileHeader) or
+            header.cells_offset % alignof(T) != 0 or
+            header.cells_offset > file_size or
+            cells > (file_size - header.cells_offset) / sizeof(T)
+        ) {
+            throw std::runtime_error("Matrix file is truncated");
+        }
+        return static_cast<std::size_t>(cells);
+    }
+
+    // reads and checks the header of a Matrix file opened for reading
+    template <MatrixFileCell T, Layout L>
+    MatrixFileHeader read_matrix_file_header(std::istream& file) {
+        file.seekg(0, std::ios::end);
+        const auto size = static_cast<std::size_t>(file.tellg());
+        file.seekg(0);
+        MatrixFileHeader header = {};
+        if (size < sizeof(header) or not file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+            throw std::runtime_error("Matrix file is truncated");
+        }
+        check_matrix_file_header<T, L>(header, size);
+        return header;
+    }
+
+    // the header of a Matrix file holding rows * cols cells of type T stored
+    // with layout L, starting at a multiple of alignment bytes into the file
+    template <MatrixFileCell T, Layout L>
+    MatrixFileHeader make_matrix_file_header(std::size_t rows, std::size_t cols, std::size_t alignment) {
+        if (alignment < alignof(T) or (alignment & (alignment - 1)) != 0) {
+            throw std::runtime_error("Matrix file alignment must be a power of two");
+        }
+        MatrixFileHeader header = {};
+        std::memcpy(header.magic, MATRIX_FILE_MAGIC, sizeof(header.magic));
+        header.version = MATRIX_FILE_VERSION;
+        header.byte_order = MATRIX_FILE_BYTE_ORDER;
+        header.kind = cell_kind_v<T>;
+        header.cell_size = sizeof(T);
+        header.layout = static_cast<std::uint8_t>(L);
+        header.rows = rows;
+        header.cols = cols;
+        header.alignment = alignment;
+        header.cells_offset = (sizeof(header) + alignment - 1) / alignment * alignment;
+        return header;
+    }
+
+    // writes header to a Matrix file opened for writing, padded up to where
+    // the cells start
+    inline void write_matrix_file_header(std::ostream& file, const MatrixFileHeader& header) {
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (std::size_t i = sizeof(header); i < header.cells_offset; i++) {
+            file.put('\0');
+        }
+    }
+} // namespace detail
+
+// writes the cells of any kind of Matrix to a Matrix file at path, in the order
+// they're stored in, starting at a multiple of alignment bytes into the file
+template <MatrixLike X>
+void save_matrix(
+    const std::filesystem::path& path,
+    const X& matrix,
+    std::size_t alignment = MATRIX_FILE_ALIGNMENT
+) {
+    using T = typename X::value_type;
+    static_assert(detail::MatrixFileCell<T>, "Matrix element type can't be stored in a Matrix file");
+    auto header = detail::make_matrix_file_header<T, detail::layout_of_v<X>>(
+        matrix.row_count(), matrix.col_count(), alignment
+    );
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (not file) {
+        throw std::runtime_error("Matrix file can't be opened");
+    }
+    detail::write_matrix_file_header(file, header);
+    auto cells = matrix.contents();
+    file.write(reinterpret_cast<const char*>(cells.data()), static_cast<std::streamsize>(cells.size_bytes()));
+    if (not file.flush()) {
+        throw std::runtime_error("Matrix file can't be written");
+    }
+}
+
+// reads a Matrix file into a new dynamic Matrix with layout L, straight into
+// its cells if the file has the same layout, otherwise through a copy
+template <typename T, Layout L = Layout::ROW_MAJOR>
+Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, AlignedAllocator<T>, L> load_matrix(
+    const std::filesystem::path& path
+) {
+    static_assert(detail::MatrixFileCell<T>, "Matrix element type can't be stored in a Matrix file");
+    std::ifstream file(path, std::ios::binary);
+    if (not file) {
+        throw std::runtime_error("Matrix file can't be opened");
+    }
+    // peek at the layout, the full header is checked for that layout
+    detail::MatrixFileHeader header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (file and header.layout == static_cast<std::uint8_t>(detail::opposite_layout(L))) {
+        return Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, AlignedAllocator<T>, L>(
+            load_matrix<T, detail::opposite_layout(L)>(path)
+        );
+    }
+    header = detail::read_matrix_file_header<T, L>(file);
+    Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, AlignedAllocator<T>, L> matrix(
+        static_cast<std::size_t>(header.rows), static_cast<std::size_t>(header.cols)
+    );
+    auto cells = matrix.contents();
+    file.seekg(static_cast<std::streamoff>(header.cells_offset));
+    if (not file.read(reinterpret_cast<char*>(cells.data()), static_cast<std::streamsize>(cells.size_bytes()))) {
+        throw std::runtime_error("Matrix file is truncated");
+    }
+    return matrix;
+}
+
+// dynamic-size Matrix backed by a mapping of a Matrix file, which opens
+// without reading the cells, the pages of the file are read in as the cells
+// on them are first accessed
+// the file must store cells of type T with layout L
+// T may be const-qualified to map the file read-only, otherwise it's mapped
+// copy-on-write, so that the cells can be changed but the file never is
+// NOTE: this is a MatrixLike, so it can be used wherever one is accepted, and
+// its view() takes part in element-wise expressions
+template <typename T, Layout L = Layout::ROW_MAJOR>
+class MappedMatrix {
+    static_assert(
+        detail::MatrixFileCell<std::remove_const_t<T>>, "Matrix element type can't be stored in a Matrix file"
+    );
+public:
+    using value_type = std::remove_const_t<T>;
+    static constexpr Layout layout = L;
+    // maps the Matrix file at path
+    explicit MappedMatrix(const std::filesystem::path& path)
+      : _mapping(path, not std::is_const_v<T>)
+      {
+        if (_mapping.size() < sizeof(detail::MatrixFileHeader)) {
+            throw std::runtime_error("Matrix file is truncated");
+        }
+        detail::MatrixFileHeader header = {};
+        std::memcpy(&header, _mapping.data(), sizeof(header));
+        detail::check_matrix_file_header<value_type, L>(header, _mapping.size());
+        _m = static_cast<std::size_t>(header.rows);
+        _n = static_cast<std::size_t>(header.cols);
+        _cells = reinterpret_cast<T*>(_mapping.data() + header.cells_offset);
+    }
+    // getters for dimensions
+    std::size_t row_count() const { return _m; }
+    std::size_t col_count() const { return _n; }
+    // get matrix dimensions as pair of <rows, columns>
+    std::pair<std::size_t, std::size_t> dimensions() const {
+        return {_m, _n};
+    }
+    // read-only accessor for matrix contents
+    std::span<const value_type> contents() const {
+        return std::span<const value_type>(_cells, _m * _n);
+    }
+    // read-write accessor for matrix contents, of copy-on-write mappings only
+    std::span<T> contents() requires (not std::is_const_v<T>) {
+        return std::span<T>(_cells, _m * _n);
+    }
+    // read-only view of the whole Matrix
+    MatrixView<const value_type> view() const {
+        return MatrixView<const value_type>(
+            _cells, _m, _n, detail::row_stride<L>(_m, _n), detail::col_stride<L>(_m, _n)
+        );
+    }
+    // read-only accessor for a specific cell of the Matrix, bounds-checked
+    const value_type& at(std::size_t m, std::size_t n) const {
+        if (m >= _m or n >= _n) {
+            throw std::runtime_error("Matrix[] indices out of bounds");
+        }
+        return _cells[detail::cell_index<L>(m, n, _m, _n)];
+    }
+    // read-write accessor for a specific cell of the Matrix, bounds-checked,
+    // of copy-on-write mappings only
+    T& at(std::size_t m, std::size_t n) requires (not std::is_const_v<T>) {
+        if (m >= _m or n >= _n) {
+            throw std::runtime_error("Matrix[] indices out of bounds");
+        }
+        return _cells[detail::cell_index<L>(m, n, _m, _n)];
+    }
+    // read-only accessor for a specific cell of the Matrix
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    const value_type& operator()(std::size_t m, std::size_t n) const {
+        if constexpr (GRYDE_CHECKED_CELL_ACCESS) {
+            return at(m, n);
+        } else {
+            assert(m < _m and n < _n);
+            return _cells[detail::cell_index<L>(m, n, _m, _n)];
+        }
+    }
+    // read-write accessor for a specific cell of the Matrix, of copy-on-write
+    // mappings only
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    T& operator()(std::size_t m, std::size_t n) requires (not std::is_const_v<T>) {
+        if constexpr (GRYDE_CHECKED_CELL_ACCESS) {
+            return at(m, n);
+        } else {
+            assert(m < _m and n < _n);
+            return _cells[detail::cell_index<L>(m, n, _m, _n)];
+        }
+    }
+private:
+    detail::FileMapping _mapping;
+    std::size_t _m = 0;
+    std::size_t _n = 0;
+    T* _cells = nullptr;
+};
+} // namespace com::saxbophone::gryde
+#endif // include guard
@@ -0,0 +1,166 @@
+#ifndef COM_SAXBOPHONE_GRYDE_MATRIX_VIEW_HPP
+#define COM_SAXBOPHONE_GRYDE_MATRIX_VIEW_HPP
+
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <cassert>
+#include <cstddef>
+
+#include <gryde/Expression.hpp>
+
+namespace com::saxbophone::gryde {
+// non-owning view of the cells of a Matrix (or any other strided storage),
+// which can represent a block, a transposition or a Matrix with a row and/or
+// column removed without copying anything
+// T may be const-qualified for a read-only view
+// NOTE: views must not outlive the storage they refer to
+template <typename T>
+class MatrixView {
+public:
+    using value_type = std::remove_const_t<T>;
+    // views are usable as leaves of element-wise expressions
+    static constexpr std::size_t ROWS = detail::DYNAMIC_EXTENT;
+    static constexpr std::size_t COLS = detail::DYNAMIC_EXTENT;
+    static constexpr bool CONTIGUOUS = false;
+    static constexpr Layout LAYOUT = Layout::ROW_MAJOR;
+    // views m * n cells where cell (i, j) is data[i * row_stride + j * col_stride]
+    constexpr MatrixView(
+        T* data,
+        std::size_t m,
+        std::size_t n,
+        std::size_t row_stride,
+        std::size_t col_stride
+      )
+      : _data(data)
+      , _m(m)
+      , _n(n)
+      , _row_stride(row_stride)
+      , _col_stride(col_stride)
+      , _skip_row(NONE)
+      , _skip_col(NONE)
+      {}
+    // read-write views convert to read-only views
+    constexpr operator MatrixView<const T>() const requires (not std::is_const_v<T>) {
+        return MatrixView<const T>(
+            _data, _m, _n, _row_stride, _col_stride, _skip_row, _skip_col
+        );
+    }
+    // getters for dimensions
+    constexpr std::size_t row_count() const { return _m; }
+    constexpr std::size_t col_count() const { return _n; }
+    // get view dimensions as pair of <rows, columns>
+    constexpr std::pair<std::size_t, std::size_t> dimensions() const {
+        return {_m, _n};
+    }
+    // accessor for a specific cell of the view, bounds-checked
+    constexpr T& at(std::size_t m, std::size_t n) const {
+        // validate indices
+        if (m >= _m or n >= _n) {
+            throw std::runtime_error("MatrixView[] indices out of bounds");
+        }
+        return _data[_offset(m, n)];
+    }
+    // accessor for a specific cell of the view, only checked by assertion
+    constexpr T& operator()(std::size_t m, std::size_t n) const {
+        assert(m < _m and n < _n);
+        return _data[_offset(m, n)];
+    }
+    // view of the rows * cols block of cells starting at cell (row, col)
+    constexpr MatrixView block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const {
+        // validate block is inside this view
+        if (row > _m or col > _n or rows > _m - row or cols > _n - col) {
+            throw std::runtime_error("MatrixView block out of bounds");
+        }
+        // when the block starts after a skipped row or column, the skip has
+        // already been accounted for in the address of its first cell
+        return MatrixView(
+            _data + _offset(row, col),
+            rows,
+            cols,
+            _row_stride,
+            _col_stride,
+            _skip_row > row and _skip_row != NONE ? _skip_row - row : NONE,
+            _skip_col > col and _skip_col != NONE ? _skip_col - col : NONE
+        );
+    }
+    // view of the transposition of this view
+    constexpr MatrixView transpose() const {
+        return MatrixView(
+            _data, _n, _m, _col_stride, _row_stride, _skip_col, _skip_row
+        );
+    }
+    // view with the specified row removed
+    // only one row which isn't the first or last row can be removed from a view
+    constexpr MatrixView remove_row(std::size_t row) const {
+        // validate row index
+        if (row >= _m) {
+            throw std::runtime_error("Row index out of bounds");
+        }
+        if (row == 0) {
+            return block(1, 0, _m - 1, _n);
+        } else if (row == _m - 1) {
+            return block(0, 0, _m - 1, _n);
+        } else if (_skip_row != NONE) {
+            throw std::runtime_error("MatrixView already has a row removed");
+        }
+        return MatrixView(
+            _data, _m - 1, _n, _row_stride, _col_stride, row, _skip_col
+        );
+    }
+    // view with the specified column removed
+    // only one column which isn't the first or last column can be removed from a view
+    constexpr MatrixView remove_col(std::size_t col) const {
+        return transpose().remove_row(col).transpose();
+    }
+    // view with the specified row and column removed
+    constexpr MatrixView submatrix(std::size_t row, std::size_t col) const {
+        return remove_row(row).remove_col(col);
+    }
+private:
+    // marks that no row or column is skipped
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    // a view with skipped row/column, only views make these
+    template <typename U>
+    friend class MatrixView;
+
+    constexpr MatrixView(
+        T* data,
+        std::size_t m,
+        std::size_t n,
+        std::size_t row_stride,
+        std::size_t col_stride,
+        std::size_t skip_row,
+        std::size_t skip_col
+      )
+      : _data(data)
+      , _m(m)
+      , _n(n)
+      , _row_stride(row_stride)
+      , _col_stride(col_stride)
+      , _skip_row(skip_row)
+      , _skip_col(skip_col)
+      {}
+
+    // offset of the cell at (m, n) from the start of the view, stepping over
+    // the skipped row and column if there are any
+    constexpr std::size_t _offset(std::size_t m, std::size_t n) const {
+        return (m + (m >= _skip_row)) * _row_stride + (n + (n >= _skip_col)) * _col_stride;
+    }
+
+    T* _data;
+    // dimensions
+    std::size_t _m;
+    std::size_t _n;
+    // distance between cells of consecutive rows and columns
+    std::size_t _row_stride;
+    std::size_t _col_stride;
+    // the row and column, if any, which are stepped over
+    std::size_t _skip_row;
+    std::size_t _skip_col;
+};
+} // namespace com::saxbophone::gryde
+#endif // include guard
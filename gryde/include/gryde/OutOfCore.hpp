@@ -0,0 +1,189 @@
+#ifndef COM_SAXBOPHONE_GRYDE_OUT_OF_CORE_HPP
+#define COM_SAXBOPHONE_GRYDE_OUT_OF_CORE_HPP
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <utility>
+
+#include <cstddef>
+
+#include <gryde/Execution.hpp>
+#include <gryde/Layout.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/MatrixFile.hpp>
+
+// multiplication of matrices in Matrix files which don't fit in memory, by
+// streaming tiles of them through the in-memory multiplication
+namespace com::saxbophone::gryde {
+// tiles are at most this many cells along each side by default, which keeps
+// the five tiles held at once for doubles to 40MiB
+inline constexpr std::size_t OUT_OF_CORE_TILE_SIZE = 1024;
+
+namespace detail {
+    // a row-major Matrix file which tiles are read from or written to
+    template <MatrixFileCell T>
+    class TiledMatrixFile {
+    public:
+        // opens an existing Matrix file for reading tiles from
+        explicit TiledMatrixFile(const std::filesystem::path& path)
+          : _file(path, std::ios::in | std::ios::binary)
+          {
+            if (not _file) {
+                throw std::runtime_error("Matrix file can't be opened");
+            }
+            _header = read_matrix_file_header<T, Layout::ROW_MAJOR>(_file);
+        }
+        // creates a Matrix file of rows * cols cells for writing tiles to,
+        // replacing any file already at path
+        TiledMatrixFile(const std::filesystem::path& path, std::size_t rows, std::size_t cols)
+          : _header(make_matrix_file_header<T, Layout::ROW_MAJOR>(rows, cols, MATRIX_FILE_ALIGNMENT))
+          {
+            {
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                if (not file) {
+                    throw std::runtime_error("Matrix file can't be opened");
+                }
+                write_matrix_file_header(file, _header);
+                if (not file.flush()) {
+                    throw std::runtime_error("Matrix file can't be written");
+                }
+            }
+            // the cells are only written a tile at a time, so size the file
+            // for all of them up front
+            std::filesystem::resize_file(path, _header.cells_offset + rows * cols * sizeof(T));
+            _file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+            if (not _file) {
+                throw std::runtime_error("Matrix file can't be opened");
+            }
+        }
+        std::size_t row_count() const { return static_cast<std::size_t>(_header.rows); }
+        std::size_t col_count() const { return static_cast<std::size_t>(_header.cols); }
+        // reads the rows * cols tile whose top-left cell is (m, n)
+        Matrix<T> read(std::size_t m, std::size_t n, std::size_t rows, std::size_t cols) {
+            Matrix<T> tile(rows, cols);
+            T* cells = tile.contents().data();
+            _transfer(m, n, rows, cols, [&](std::size_t first, std::size_t count) {
+                return static_cast<bool>(_file.read(
+                    reinterpret_cast<char*>(cells + first), static_cast<std::streamsize>(count * sizeof(T))
+                ));
+            });
+            return tile;
+        }
+        // writes tile so that its top-left cell is (m, n)
+        void write(std::size_t m, std::size_t n, const Matrix<T>& tile) {
+            const T* cells = tile.contents().data();
+            _transfer(m, n, tile.row_count(), tile.col_count(), [&](std::size_t first, std::size_t count) {
+                return static_cast<bool>(_file.write(
+                    reinterpret_cast<const char*>(cells + first), static_cast<std::streamsize>(count * sizeof(T))
+                ));
+            });
+        }
+        // makes sure everything written has reached the file
+        void flush() {
+            if (not _file.flush()) {
+                throw std::runtime_error("Matrix file can't be written");
+            }
+        }
+    private:
+        // reads or writes the rows of a tile, which are each contiguous in the
+        // file, as is the whole tile if it spans the full width
+        // transfer(first, count) moves count cells of the tile from first on
+        template <typename Transfer>
+        void _transfer(std::size_t m, std::size_t n, std::size_t rows, std::size_t cols, Transfer transfer) {
+            const bool whole_rows = cols == col_count();
+            const std::size_t runs = whole_rows ? 1 : rows;
+            const std::size_t run = whole_rows ? rows * cols : cols;
+            for (std::size_t r = 0; r < runs and run != 0; r++) {
+                // the get and put positions of a file stream are the same
+                _file.seekg(static_cast<std::streamoff>(
+                    _header.cells_offset + ((m + r) * col_count() + n) * sizeof(T)
+                ));
+                if (not transfer(r * run, run)) {
+                    throw std::runtime_error("Matrix file can't be read or written");
+                }
+            }
+        }
+
+        std::fstream _file;
+        MatrixFileHeader _header = {};
+    };
+} // namespace detail
+
+// multiplies the matrices in the row-major Matrix files at lhs and rhs, which
+// must hold cells of type T, and writes the product to a new Matrix file at
+// product, without ever holding more than a few tiles of them in memory
+// tiles are multiplied with the given execution policy, while the next ones
+// are read in the background, so that reading them overlaps with multiplying
+template <typename T, execution::ExecutionPolicy Policy>
+void multiply_files(
+    const Policy& policy,
+    const std::filesystem::path& lhs,
+    const std::filesystem::path& rhs,
+    const std::filesystem::path& product,
+    std::size_t tile_size = OUT_OF_CORE_TILE_SIZE
+) {
+    static_assert(detail::MatrixFileCell<T>, "Matrix element type can't be stored in a Matrix file");
+    if (tile_size == 0) {
+        throw std::runtime_error("Tile size must be non-zero");
+    }
+    detail::TiledMatrixFile<T> a(lhs);
+    detail::TiledMatrixFile<T> b(rhs);
+    if (a.col_count() != b.row_count()) {
+        throw std::runtime_error("Matrix dimensions are incompatible for multiplication");
+    }
+    const std::size_t rows = a.row_count();
+    const std::size_t cols = b.col_count();
+    const std::size_t depth = a.col_count();
+    detail::TiledMatrixFile<T> c(product, rows, cols);
+    // number of tiles along a dimension, and the size of one of them
+    auto tile_count = [&](std::size_t size) {
+        return std::max<std::size_t>((size + tile_size - 1) / tile_size, 1);
+    };
+    auto tile_extent = [&](std::size_t index, std::size_t size) {
+        return std::min(tile_size, size - std::min(size, index * tile_size));
+    };
+    const std::size_t row_tiles = tile_count(rows);
+    const std::size_t col_tiles = tile_count(cols);
+    const std::size_t depth_tiles = tile_count(depth);
+    // step s multiplies tile (i, k) of lhs by tile (k, j) of rhs, into tile
+    // (i, j) of the product, which is held until all of its k are done
+    struct Step {
+        std::size_t i, j, k;
+    };
+    auto step = [&](std::size_t s) {
+        return Step{s / (col_tiles * depth_tiles), s / depth_tiles % col_tiles, s % depth_tiles};
+    };
+    // each file is only read by one prefetch at a time
+    auto prefetch = [&](Step next) {
+        return std::async(std::launch::async, [&a, &b, &tile_extent, tile_size, rows, cols, depth, next] {
+            const std::size_t k = tile_extent(next.k, depth);
+            return std::pair(
+                a.read(next.i * tile_size, next.k * tile_size, tile_extent(next.i, rows), k),
+                b.read(next.k * tile_size, next.j * tile_size, k, tile_extent(next.j, cols))
+            );
+        });
+    };
+    const std::size_t steps = row_tiles * col_tiles * depth_tiles;
+    auto tiles = prefetch(step(0));
+    Matrix<T> result;
+    for (std::size_t s = 0; s < steps; s++) {
+        auto [a_tile, b_tile] = tiles.get();
+        if (s + 1 < steps) {
+            tiles = prefetch(step(s + 1));
+        }
+        Step current = step(s);
+        if (current.k == 0) {
+            result = Matrix<T>(tile_extent(current.i, rows), tile_extent(current.j, cols));
+        }
+        detail::matrix_multiplication(a_tile, b_tile, result, detail::execution_pool(policy));
+        if (current.k + 1 == depth_tiles) {
+            c.write(current.i * tile_size, current.j * tile_size, result);
+        }
+    }
+    c.flush();
+}
+} // namespace com::saxbophone::gryde
+#endif // include guard
@@ -0,0 +1,338 @@
+#ifndef COM_SAXBOPHONE_GRYDE_SPARSE_MATRIX_HPP
+#define COM_SAXBOPHONE_GRYDE_SPARSE_MATRIX_HPP
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+
+#include <gryde/Execution.hpp>
+#include <gryde/Layout.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/ThreadPool.hpp>
+#include <gryde/detail/Sparse.hpp>
+
+namespace com::saxbophone::gryde {
+// how the non-zero cells of a SparseMatrix are compressed
+enum class SparseFormat {
+    ROW,    // compressed sparse row (CSR), by rows, best for products with dense matrices
+    COLUMN, // compressed sparse column (CSC), by columns
+};
+
+// one cell of a SparseMatrix, for building it from a list of cells
+template <typename T>
+struct SparseEntry {
+    std::size_t row;
+    std::size_t col;
+    T value;
+};
+
+// a Matrix which stores only its non-zero cells, compressed by rows or by
+// columns, so that its size is proportional to the number of them
+// cells which are stored are said to be non-zero, even though arithmetic may
+// have given some of them the value zero
+template <typename T, SparseFormat F = SparseFormat::ROW>
+class SparseMatrix {
+public:
+    using value_type = T;
+    static constexpr SparseFormat format = F;
+    // creates an empty M * N SparseMatrix, where every cell is zero
+    SparseMatrix(std::size_t m, std::size_t n)
+      : _m(m)
+      , _n(n)
+      , _cells{std::vector<std::size_t>(_major() + 1), {}, {}}
+      {}
+    // creates an M * N SparseMatrix with the given cells, the values of any
+    // cells given more than once are summed
+    SparseMatrix(std::size_t m, std::size_t n, std::span<const SparseEntry<T>> entries)
+      : _m(m)
+      , _n(n)
+      {
+        std::vector<std::size_t> majors(entries.size());
+        std::vector<std::size_t> minors(entries.size());
+        std::vector<T> values(entries.size());
+        for (std::size_t c = 0; c < entries.size(); c++) {
+            if (entries[c].row >= m or entries[c].col >= n) {
+                throw std::runtime_error("Matrix[] indices out of bounds");
+            }
+            majors[c] = F == SparseFormat::ROW ? entries[c].row : entries[c].col;
+            minors[c] = F == SparseFormat::ROW ? entries[c].col : entries[c].row;
+            values[c] = entries[c].value;
+        }
+        _cells = detail::sparse_compress<T>(_major(), majors, minors, values);
+    }
+    // creates an M * N SparseMatrix from existing compressed arrays, which are
+    // checked for consistency
+    // the cells of row (CSR) or column (CSC) i are at positions
+    // [offsets[i], offsets[i + 1]) of indices (their column or row indices,
+    // strictly ascending) and values
+    SparseMatrix(
+        std::size_t m, std::size_t n,
+        std::vector<std::size_t> offsets, std::vector<std::size_t> indices, std::vector<T> values
+    )
+      : _m(m)
+      , _n(n)
+      , _cells{std::move(offsets), std::move(indices), std::move(values)}
+      {
+        _check_structure();
+    }
+    // creates a SparseMatrix with the non-zero cells of a dense Matrix
+    template <MatrixLike X>
+    explicit SparseMatrix(const X& dense)
+      : _m(dense.row_count())
+      , _n(dense.col_count())
+      , _cells{std::vector<std::size_t>(_major() + 1), {}, {}}
+      {
+        static_assert(
+            std::is_same_v<typename X::value_type, T>,
+            "Matrix element type doesn't match"
+        );
+        auto contents = dense.contents();
+        for (std::size_t i = 0; i < _major(); i++) {
+            for (std::size_t j = 0; j < _minor(); j++) {
+                const std::size_t m = F == SparseFormat::ROW ? i : j;
+                const std::size_t n = F == SparseFormat::ROW ? j : i;
+                const T& cell = contents[detail::cell_index<detail::layout_of_v<X>>(m, n, _m, _n)];
+                if (cell != T{}) {
+                    _cells.indices.push_back(j);
+                    _cells.values.push_back(cell);
+                }
+            }
+            _cells.offsets[i + 1] = _cells.indices.size();
+        }
+    }
+    // converts a SparseMatrix of the other format to this one
+    template <SparseFormat G>
+    requires (G != F)
+    explicit SparseMatrix(const SparseMatrix<T, G>& other)
+      : _m(other.row_count())
+      , _n(other.col_count())
+      , _cells(detail::sparse_transpose(other._cells, _major()))
+      {}
+    // number of rows
+    std::size_t row_count() const { return _m; }
+    // number of columns
+    std::size_t col_count() const { return _n; }
+    // number of cells stored
+    std::size_t non_zero_count() const { return _cells.values.size(); }
+    // where the cells of each row (CSR) or column (CSC) start in indices() and
+    // values(), with one more at the end where the last of them ends
+    std::span<const std::size_t> offsets() const { return _cells.offsets; }
+    // the column (CSR) or row (CSC) index of each cell stored
+    std::span<const std::size_t> indices() const { return _cells.indices; }
+    // read-only accessor for the values of the cells stored
+    std::span<const T> values() const { return _cells.values; }
+    // read-write accessor for the values of the cells stored
+    std::span<T> values() { return _cells.values; }
+    // equality operator, matrices are equal if they store the same cells
+    bool operator==(const SparseMatrix& other) const = default;
+    // value of a specific cell of the Matrix, zero if it's not stored,
+    // bounds-checked
+    T at(std::size_t m, std::size_t n) const {
+        if (m >= _m or n >= _n) {
+            throw std::runtime_error("Matrix[] indices out of bounds");
+        }
+        return _find(m, n);
+    }
+    // value of a specific cell of the Matrix, zero if it's not stored
+    // only checked by assertion unless GRYDE_CHECKED_CELL_ACCESS is enabled
+    T operator()(std::size_t m, std::size_t n) const {
+        if constexpr (GRYDE_CHECKED_CELL_ACCESS) {
+            return at(m, n);
+        } else {
+            assert(m < _m and n < _n);
+            return _find(m, n);
+        }
+    }
+    // dense Matrix with the same cells
+    Matrix<T> to_dense() const {
+        Matrix<T> dense(_m, _n);
+        auto contents = dense.contents();
+        for (std::size_t i = 0; i < _major(); i++) {
+            for (std::size_t c = _cells.offsets[i]; c < _cells.offsets[i + 1]; c++) {
+                const std::size_t j = _cells.indices[c];
+                (F == SparseFormat::ROW ? contents[i * _n + j] : contents[j * _n + i]) = _cells.values[c];
+            }
+        }
+        return dense;
+    }
+    // transpose of the Matrix, in the same format
+    SparseMatrix transpose() const {
+        return SparseMatrix(_n, _m, detail::sparse_transpose(_cells, _minor()));
+    }
+    // sum of two matrices of the same format
+    SparseMatrix operator+(const SparseMatrix& other) const {
+        return _add<false>(other, detail::default_execution_pool().load());
+    }
+    // difference of two matrices of the same format
+    SparseMatrix operator-(const SparseMatrix& other) const {
+        return _add<true>(other, detail::default_execution_pool().load());
+    }
+    // the Matrix multiplied by a scalar
+    SparseMatrix operator*(const T& scalar) const {
+        SparseMatrix product = *this;
+        for (auto& value : product._cells.values) {
+            value *= scalar;
+        }
+        return product;
+    }
+    // product of two matrices of the same format, spread across the default
+    // execution pool, if there is one
+    SparseMatrix operator*(const SparseMatrix& other) const {
+        return _multiply(other, detail::default_execution_pool().load());
+    }
+    // product of the Matrix and a dense vector, spread across the default
+    // execution pool, if there is one
+    std::vector<T> operator*(std::span<const T> vector) const {
+        return _multiply(vector, detail::default_execution_pool().load());
+    }
+    // product of the Matrix and a dense Matrix, spread across the default
+    // execution pool, if there is one
+    template <MatrixLike X>
+    Matrix<T> operator*(const X& dense) const {
+        return _multiply(dense, detail::default_execution_pool().load());
+    }
+private:
+    template <typename U, SparseFormat G>
+    friend class SparseMatrix;
+
+    template <execution::ExecutionPolicy Policy, typename U, SparseFormat G, typename R>
+    friend auto multiply(const Policy& policy, const SparseMatrix<U, G>& lhs, const R& rhs);
+
+    // creates a SparseMatrix from compressed arrays known to be consistent
+    SparseMatrix(std::size_t m, std::size_t n, detail::CompressedCells<T> cells)
+      : _m(m)
+      , _n(n)
+      , _cells(std::move(cells))
+      {}
+
+    // number of rows (CSR) or columns (CSC), which the cells are compressed by
+    std::size_t _major() const { return F == SparseFormat::ROW ? _m : _n; }
+    // number of columns (CSR) or rows (CSC)
+    std::size_t _minor() const { return F == SparseFormat::ROW ? _n : _m; }
+
+    void _check_structure() const {
+        bool valid = _cells.offsets.size() == _major() + 1
+            and _cells.offsets.front() == 0
+            and _cells.offsets.back() == _cells.indices.size()
+            and _cells.indices.size() == _cells.values.size();
+        for (std::size_t i = 0; valid and i < _major(); i++) {
+            valid = _cells.offsets[i] <= _cells.offsets[i + 1] and _cells.offsets[i + 1] <= _cells.indices.size();
+            for (std::size_t c = _cells.offsets[i]; valid and c < _cells.offsets[i + 1]; c++) {
+                valid = _cells.indices[c] < _minor() and (c == _cells.offsets[i] or _cells.indices[c - 1] < _cells.indices[c]);
+            }
+        }
+        if (not valid) {
+            throw std::runtime_error("Sparse Matrix structure is invalid");
+        }
+    }
+
+    // binary search of the sorted line of the cell
+    T _find(std::size_t m, std::size_t n) const {
+        const std::size_t i = F == SparseFormat::ROW ? m : n;
+        const std::size_t j = F == SparseFormat::ROW ? n : m;
+        auto begin = _cells.indices.begin() + static_cast<std::ptrdiff_t>(_cells.offsets[i]);
+        auto end = _cells.indices.begin() + static_cast<std::ptrdiff_t>(_cells.offsets[i + 1]);
+        auto found = std::lower_bound(begin, end, j);
+        if (found == end or *found != j) {
+            return T{};
+        }
+        return _cells.values[static_cast<std::size_t>(found - _cells.indices.begin())];
+    }
+
+    template <bool SUBTRACT>
+    SparseMatrix _add(const SparseMatrix& other, ThreadPool* pool) const {
+        if (_m != other._m or _n != other._n) {
+            throw std::runtime_error("Matrix dimensions don't match");
+        }
+        return SparseMatrix(_m, _n, detail::sparse_add<SUBTRACT>(_cells, other._cells, pool));
+    }
+
+    SparseMatrix _multiply(const SparseMatrix& other, ThreadPool* pool) const {
+        if (_n != other._m) {
+            throw std::runtime_error("Matrix dimensions are incompatible for multiplication");
+        }
+        if constexpr (F == SparseFormat::ROW) {
+            // each row of the product is a sum of rows of other
+            return SparseMatrix(_m, other._n, detail::sparse_multiply(_cells, other._cells, other._n, pool));
+        } else {
+            // each column of the product is a sum of columns of this
+            return SparseMatrix(_m, other._n, detail::sparse_multiply(other._cells, _cells, _m, pool));
+        }
+    }
+
+    std::vector<T> _multiply(std::span<const T> vector, ThreadPool* pool) const {
+        if (vector.size() != _n) {
+            throw std::runtime_error("Matrix dimensions are incompatible for multiplication");
+        }
+        std::vector<T> product(_m);
+        _multiply(vector.data(), product.data(), 1, pool);
+        return product;
+    }
+
+    template <MatrixLike X>
+    Matrix<T> _multiply(const X& dense, ThreadPool* pool) const {
+        static_assert(
+            std::is_same_v<typename X::value_type, T>,
+            "Matrix element types don't match"
+        );
+        if (_n != dense.row_count()) {
+            throw std::runtime_error("Matrix dimensions are incompatible for multiplication");
+        }
+        if constexpr (detail::layout_of_v<X> != Layout::ROW_MAJOR) {
+            // the kernels read row-major cells
+            Matrix<T> rows(dense.row_count(), dense.col_count());
+            detail::copy_cells<Layout::ROW_MAJOR>(dense, rows.contents());
+            return _multiply(rows, pool);
+        }
+        Matrix<T> product(_m, dense.col_count());
+        _multiply(dense.contents().data(), product.contents().data(), dense.col_count(), pool);
+        return product;
+    }
+
+    // product with the N * columns row-major cells at b, into the zeroed
+    // M * columns row-major cells at out
+    void _multiply(const T* b, T* out, std::size_t columns, ThreadPool* pool) const {
+        if constexpr (F == SparseFormat::ROW) {
+            detail::sparse_gather_multiply(_cells, b, out, columns, pool);
+        } else {
+            detail::sparse_scatter_multiply(_cells, _m, b, out, columns, pool);
+        }
+    }
+
+    std::size_t _m;
+    std::size_t _n;
+    detail::CompressedCells<T> _cells;
+};
+
+// compressed sparse row Matrix
+template <typename T>
+using CsrMatrix = SparseMatrix<T, SparseFormat::ROW>;
+
+// compressed sparse column Matrix
+template <typename T>
+using CscMatrix = SparseMatrix<T, SparseFormat::COLUMN>;
+
+// scalar * SparseMatrix
+template <typename T, SparseFormat F>
+SparseMatrix<T, F> operator*(const std::type_identity_t<T>& scalar, const SparseMatrix<T, F>& matrix) {
+    return matrix * scalar;
+}
+
+// product of a SparseMatrix and another of the same format, a dense vector or
+// a dense Matrix, run with the given execution policy
+template <execution::ExecutionPolicy Policy, typename T, SparseFormat F, typename R>
+auto multiply(const Policy& policy, const SparseMatrix<T, F>& lhs, const R& rhs) {
+    if constexpr (MatrixLike<R> or std::is_same_v<R, SparseMatrix<T, F>>) {
+        return lhs._multiply(rhs, detail::execution_pool(policy));
+    } else {
+        return lhs._multiply(std::span<const T>(rhs), detail::execution_pool(policy));
+    }
+}
+} // namespace com::saxbophone::gryde
+#endif // include guard
@@ -0,0 +1,490 @@
+#ifndef COM_SAXBOPHONE_GRYDE_TEXT_FILE_HPP
+#define COM_SAXBOPHONE_GRYDE_TEXT_FILE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cctype>
+#include <cstddef>
+
+#include <gryde/AlignedAllocator.hpp>
+#include <gryde/Execution.hpp>
+#include <gryde/Layout.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/SparseMatrix.hpp>
+#include <gryde/ThreadPool.hpp>
+#include <gryde/detail/FileMapping.hpp>
+#include <gryde/detail/Sparse.hpp>
+#include <gryde/detail/Text.hpp>
+
+// loading and saving matrices as comma-separated values (CSV) and in the
+// Matrix Market exchange format, with files split into chunks of lines which
+// are parsed or formatted in parallel, straight into the cells of the Matrix
+namespace com::saxbophone::gryde {
+namespace detail {
+    // the whole of a mapped text file
+    inline std::string_view text_of(const FileMapping& file) {
+        return std::string_view(reinterpret_cast<const char*>(file.data()), file.size());
+    }
+
+    // the kinds of value a Matrix Market file can hold, apart from complex
+    enum class MatrixMarketField {
+        REAL,
+        INTEGER,
+        PATTERN, // no values, every cell listed is one
+    };
+
+    // which cells of a Matrix Market file are listed
+    enum class MatrixMarketSymmetry {
+        GENERAL,        // all of them
+        SYMMETRIC,      // the lower triangle, mirrored into the upper
+        SKEW_SYMMETRIC, // the lower triangle, mirrored and negated
+    };
+
+    struct MatrixMarketHeader {
+        bool coordinate;
+        MatrixMarketField field;
+        MatrixMarketSymmetry symmetry;
+        std::size_t rows;
+        std::size_t cols;
+        // the number of lines of entries
+        std::size_t entries;
+        // the text following the size line, which holds the entries
+        std::string_view body;
+    };
+
+    // keywords of the Matrix Market banner aren't case-sensitive
+    inline bool keyword_equals(std::string_view token, std::string_view keyword) {
+        return std::equal(
+            token.begin(), token.end(), keyword.begin(), keyword.end(),
+            [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; }
+        );
+    }
+
+    inline MatrixMarketHeader read_matrix_market_header(std::string_view text) {
+        std::string_view banner = next_line(text);
+        if (
+            not keyword_equals(next_token(banner), "%%matrixmarket") or
+            not keyword_equals(next_token(banner), "matrix")
+        ) {
+            throw std::runtime_error("Matrix Market file has no banner");
+        }
+        MatrixMarketHeader header = {};
+        std::string_view format = next_token(banner);
+        if (keyword_equals(format, "coordinate")) {
+            header.coordinate = true;
+        } else if (not keyword_equals(format, "array")) {
+            throw std::runtime_error("Matrix Market format is unsupported");
+        }
+        std::string_view field = next_token(banner);
+        if (keyword_equals(field, "real") or keyword_equals(field, "double")) {
+            header.field = MatrixMarketField::REAL;
+        } else if (keyword_equals(field, "integer")) {
+            header.field = MatrixMarketField::INTEGER;
+        } else if (keyword_equals(field, "pattern") and header.coordinate) {
+            header.field = MatrixMarketField::PATTERN;
+        } else {
+            throw std::runtime_error("Matrix Market field is unsupported");
+        }
+        std::string_view symmetry = next_token(banner);
+        if (keyword_equals(symmetry, "general")) {
+            header.symmetry = MatrixMarketSymmetry::GENERAL;
+        } else if (keyword_equals(symmetry, "symmetric") or keyword_equals(symmetry, "hermitian")) {
+            // without complex values, hermitian is the same as symmetric
+            header.symmetry = MatrixMarketSymmetry::SYMMETRIC;
+        } else if (keyword_equals(symmetry, "skew-symmetric")) {
+            header.symmetry = MatrixMarketSymmetry::SKEW_SYMMETRIC;
+        } else {
+            throw std::runtime_error("Matrix Market symmetry is unsupported");
+        }
+        // only the cells of general arrays are listed in full
+        if (not header.coordinate and header.symmetry != MatrixMarketSymmetry::GENERAL) {
+            throw std::runtime_error("Matrix Market symmetry is unsupported");
+        }
+        // comments and blank lines come between the banner and the size line
+        std::string_view size_line;
+        do {
+            if (text.empty()) {
+                throw std::runtime_error("Matrix Market file has no size line");
+            }
+            size_line = trim(next_line(text));
+        } while (size_line.empty() or size_line.front() == '%');
+        header.rows = parse_number<std::size_t>(next_token(size_line));
+        header.cols = parse_number<std::size_t>(next_token(size_line));
+        if (header.coordinate) {
+            header.entries = parse_number<std::size_t>(next_token(size_line));
+        } else if (header.cols != 0 and header.rows > std::numeric_limits<std::size_t>::max() / header.cols) {
+            throw std::runtime_error("Matrix Market file has the wrong number of entries");
+        } else {
+            header.entries = header.rows * header.cols;
+        }
+        if (not trim(size_line).empty()) {
+            throw std::runtime_error("Matrix text value can't be parsed");
+        }
+        if (header.symmetry != MatrixMarketSymmetry::GENERAL and header.rows != header.cols) {
+            throw std::runtime_error("Matrix Market symmetric matrix must be square");
+        }
+        header.body = text;
+        return header;
+    }
+
+    // the row and column of the cell given by a line of a coordinate Matrix
+    // Market file, with its indices counted from zero, taken off the front of
+    // the line
+    inline std::pair<std::size_t, std::size_t> parse_matrix_market_position(
+        const MatrixMarketHeader& header, std::string_view& line
+    ) {
+        const std::size_t row = parse_number<std::size_t>(next_token(line));
+        const std::size_t col = parse_number<std::size_t>(next_token(line));
+        // indices count from one
+        if (row == 0 or row > header.rows or col == 0 or col > header.cols) {
+            throw std::runtime_error("Matrix Market entry is out of bounds");
+        }
+        return {row - 1, col - 1};
+    }
+
+    // the cell given by a line of a coordinate Matrix Market file, with its
+    // indices counted from zero
+    template <TextCell T>
+    SparseEntry<T> parse_matrix_market_entry(const MatrixMarketHeader& header, std::string_view line) {
+        const auto [row, col] = parse_matrix_market_position(header, line);
+        const T value = header.field == MatrixMarketField::PATTERN ? T{1} : parse_number<T>(next_token(line));
+        if (not trim(line).empty()) {
+            throw std::runtime_error("Matrix text value can't be parsed");
+        }
+        return {row, col, value};
+    }
+
+    // the value of the cell mirroring one listed in a symmetric file
+    template <TextCell T>
+    T mirrored_value(const MatrixMarketHeader& header, T value) {
+        return header.symmetry == MatrixMarketSymmetry::SKEW_SYMMETRIC ? static_cast<T>(T{} - value) : value;
+    }
+
+    // splits the entries of a Matrix Market file into chunks, checking that
+    // there are as many as the header says
+    inline TextChunks split_matrix_market_entries(ThreadPool* pool, const MatrixMarketHeader& header) {
+        TextChunks split = split_lines(pool, header.body);
+        if (split.line_count != header.entries) {
+            throw std::runtime_error("Matrix Market file has the wrong number of entries");
+        }
+        return split;
+    }
+
+    // the cells of a coordinate Matrix Market file, compressed by row if
+    // by_row is true, by column otherwise
+    // the file is read twice: once for the indices alone, to count the cells
+    // of each line, then again to place each cell straight into its line
+    template <TextCell T>
+    CompressedCells<T> read_matrix_market_coordinates(
+        ThreadPool* pool, const MatrixMarketHeader& header, const TextChunks& split, bool by_row
+    ) {
+        // a cell on the diagonal is its own mirror
+        const bool mirror = header.symmetry != MatrixMarketSymmetry::GENERAL;
+        const std::size_t major = by_row ? header.rows : header.cols;
+        // counts of the cells of each line, then the next position in each
+        std::vector<std::atomic<std::size_t>> next(major);
+        auto line_of = [&](std::size_t row, std::size_t col) -> std::atomic<std::size_t>& {
+            return next[by_row ? row : col];
+        };
+        for_each_line(pool, split, [&](std::size_t, std::string_view line) {
+            const auto [row, col] = parse_matrix_market_position(header, line);
+            line_of(row, col).fetch_add(1, std::memory_order_relaxed);
+            if (mirror and row != col) {
+                line_of(col, row).fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        CompressedCells<T> cells;
+        cells.offsets.resize(major + 1);
+        for (std::size_t i = 0; i < major; i++) {
+            cells.offsets[i + 1] = cells.offsets[i] + next[i].load(std::memory_order_relaxed);
+            next[i].store(cells.offsets[i], std::memory_order_relaxed);
+        }
+        cells.indices.resize(cells.offsets[major]);
+        cells.values.resize(cells.offsets[major]);
+        // cells land in their lines in whatever order the chunks get to them
+        for_each_line(pool, split, [&](std::size_t, std::string_view line) {
+            const SparseEntry<T> entry = parse_matrix_market_entry<T>(header, line);
+            auto place = [&](std::size_t row, std::size_t col, T value) {
+                const std::size_t position = line_of(row, col).fetch_add(1, std::memory_order_relaxed);
+                cells.indices[position] = by_row ? col : row;
+                cells.values[position] = value;
+            };
+            place(entry.row, entry.col, entry.value);
+            if (mirror and entry.row != entry.col) {
+                place(entry.col, entry.row, mirrored_value(header, entry.value));
+            }
+        });
+        sparse_merge_lines(cells, pool);
+        return cells;
+    }
+
+    // the non-zero cells of an array Matrix Market file, compressed by column
+    // each chunk of the file is read once, into cells of its own, which are
+    // already in order, as the cells of an array are listed column by column
+    template <TextCell T>
+    CompressedCells<T> read_matrix_market_array(
+        ThreadPool* pool, const MatrixMarketHeader& header, const TextChunks& split
+    ) {
+        const std::size_t chunks = split.chunks.size();
+        // the places in the listing of each chunk's non-zero cells
+        std::vector<std::vector<std::size_t>> places(chunks);
+        std::vector<std::vector<T>> values(chunks);
+        for_each_chunk_line(pool, split, [&](std::size_t c, std::size_t index, std::string_view line) {
+            const T value = parse_number<T>(trim(line));
+            if (value != T{}) {
+                places[c].push_back(index);
+                values[c].push_back(value);
+            }
+        });
+        // the chunks are joined up in order
+        std::vector<std::size_t> starts(chunks + 1);
+        for (std::size_t c = 0; c < chunks; c++) {
+            starts[c + 1] = starts[c] + places[c].size();
+        }
+        CompressedCells<T> cells;
+        cells.offsets.resize(header.cols + 1);
+        cells.indices.resize(starts[chunks]);
+        cells.values.resize(starts[chunks]);
+        text_for(pool, chunks, [&](std::size_t c) {
+            for (std::size_t p = 0; p < places[c].size(); p++) {
+                cells.indices[starts[c] + p] = places[c][p] % header.rows;
+            }
+            std::copy(values[c].begin(), values[c].end(), cells.values.begin() + static_cast<std::ptrdiff_t>(starts[c]));
+        });
+        for (const std::vector<std::size_t>& chunk : places) {
+            for (std::size_t place : chunk) {
+                cells.offsets[place / header.rows + 1]++;
+            }
+        }
+        for (std::size_t j = 0; j < header.cols; j++) {
+            cells.offsets[j + 1] += cells.offsets[j];
+        }
+        return cells;
+    }
+
+    template <TextCell T>
+    constexpr std::string_view matrix_market_field_name() {
+        return std::is_floating_point_v<T> ? "real" : "integer";
+    }
+} // namespace detail
+
+// reads a file of comma-separated values (or values separated by delimiter)
+// into a new dynamic Matrix with layout L, one row for each non-blank line,
+// parsing chunks of the file with the given execution policy
+// every row must have the same number of values, which may have whitespace
+// either side of them
+template <typename T, Layout L = Layout::ROW_MAJOR, execution::ExecutionPolicy Policy>
+Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, AlignedAllocator<T>, L> load_csv(
+    const Policy& policy,
+    const std::filesystem::path& path,
+    char delimiter = ','
+) {
+    static_assert(detail::TextCell<T>, "Matrix element type can't be read from text");
+    detail::FileMapping file(path, false);
+    const std::string_view text = detail::text_of(file);
+    ThreadPool* pool = detail::execution_pool(policy);
+    const detail::TextChunks split = detail::split_lines(pool, text);
+    // the first row gives the number of columns
+    std::size_t cols = 0;
+    for (std::string_view rest = text; not rest.empty() and cols == 0;) {
+        std::string_view line = detail::next_line(rest);
+        if (not detail::is_blank_line(line)) {
+            cols = static_cast<std::size_t>(std::count(line.begin(), line.end(), delimiter)) + 1;
+        }
+    }
+    const std::size_t rows = split.line_count;
+    Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, AlignedAllocator<T>, L> matrix(rows, cols);
+    auto cells = matrix.contents();
+    detail::for_each_line(pool, split, [&](std::size_t m, std::string_view line) {
+        std::size_t n = 0;
+        for (bool last = false; not last; n++) {
+            const std::size_t end = std::min(line.find(delimiter), line.size());
+            last = end == line.size();
+            if (n == cols) {
+                throw std::runtime_error("CSV row has the wrong number of values");
+            }
+            cells[detail::cell_index<L>(m, n, rows, cols)] = detail::parse_number<T>(
+                detail::trim(line.substr(0, end))
+            );
+            line.remove_prefix(std::min(end + 1, line.size()));
+        }
+        if (n != cols) {
+            throw std::runtime_error("CSV row has the wrong number of values");
+        }
+    });
+    return matrix;
+}
+
+// writes any kind of Matrix to a file as comma-separated values (or values
+// separated by delimiter), one line for each row, formatting chunks of rows
+// with the given execution policy
+// values are written in the shortest form which reads back the same
+template <execution::ExecutionPolicy Policy, MatrixLike X>
+void save_csv(const Policy& policy, const std::filesystem::path& path, const X& matrix, char delimiter = ',') {
+    using T = typename X::value_type;
+    static_assert(detail::TextCell<T>, "Matrix element type can't be written as text");
+    constexpr Layout L = detail::layout_of_v<X>;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (not file) {
+        throw std::runtime_error("Matrix file can't be opened");
+    }
+    const std::size_t rows = matrix.row_count();
+    const std::size_t cols = matrix.col_count();
+    auto cells = matrix.contents();
+    const std::size_t rows_per_chunk = std::max<std::size_t>(detail::TEXT_CHUNK_ITEMS / std::max<std::size_t>(cols, 1), 1);
+    detail::write_text(
+        detail::execution_pool(policy), file, rows, rows_per_chunk,
+        [&](std::size_t begin, std::size_t end, std::string& out) {
+            for (std::size_t m = begin; m < end; m++) {
+                for (std::size_t n = 0; n < cols; n++) {
+                    if (n != 0) {
+                        out += delimiter;
+                    }
+                    detail::append_number(out, cells[detail::cell_index<L>(m, n, rows, cols)]);
+                }
+                out += '\n';
+            }
+        }
+    );
+}
+
+// reads a Matrix Market file, in either array or coordinate format, into a new
+// dynamic Matrix with layout L, parsing chunks of the file with the given
+// execution policy
+// real, integer and pattern fields are read, with general, symmetric,
+// skew-symmetric and (real) hermitian symmetry
+// NOTE: cells must not be listed more than once, as the format requires
+template <typename T, Layout L = Layout::ROW_MAJOR, execution::ExecutionPolicy Policy>
+Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, AlignedAllocator<T>, L> load_matrix_market(
+    const Policy& policy,
+    const std::filesystem::path& path
+) {
+    static_assert(detail::TextCell<T>, "Matrix element type can't be read from text");
+    detail::FileMapping file(path, false);
+    const detail::MatrixMarketHeader header = detail::read_matrix_market_header(detail::text_of(file));
+    ThreadPool* pool = detail::execution_pool(policy);
+    const detail::TextChunks split = detail::split_matrix_market_entries(pool, header);
+    const std::size_t rows = header.rows;
+    const std::size_t cols = header.cols;
+    Matrix<T, detail::DYNAMIC_EXTENT, detail::DYNAMIC_EXTENT, AlignedAllocator<T>, L> matrix(rows, cols);
+    auto cells = matrix.contents();
+    if (header.coordinate) {
+        detail::for_each_line(pool, split, [&](std::size_t, std::string_view line) {
+            const SparseEntry<T> entry = detail::parse_matrix_market_entry<T>(header, line);
+            cells[detail::cell_index<L>(entry.row, entry.col, rows, cols)] = entry.value;
+            if (header.symmetry != detail::MatrixMarketSymmetry::GENERAL and entry.row != entry.col) {
+                cells[detail::cell_index<L>(entry.col, entry.row, rows, cols)] = detail::mirrored_value(header, entry.value);
+            }
+        });
+    } else {
+        // the cells of an array are listed column by column
+        detail::for_each_line(pool, split, [&](std::size_t c, std::string_view line) {
+            cells[detail::cell_index<L>(c % rows, c / rows, rows, cols)] = detail::parse_number<T>(detail::trim(line));
+        });
+    }
+    return matrix;
+}
+
+// reads a Matrix Market file into a new SparseMatrix with format F, parsing
+// chunks of the file with the given execution policy, the same as
+// load_matrix_market() otherwise, except that the values of any cells listed
+// more than once are summed, smallest first
+template <typename T, SparseFormat F = SparseFormat::ROW, execution::ExecutionPolicy Policy>
+SparseMatrix<T, F> load_sparse_matrix_market(const Policy& policy, const std::filesystem::path& path) {
+    static_assert(detail::TextCell<T>, "Matrix element type can't be read from text");
+    detail::FileMapping file(path, false);
+    const detail::MatrixMarketHeader header = detail::read_matrix_market_header(detail::text_of(file));
+    ThreadPool* pool = detail::execution_pool(policy);
+    const detail::TextChunks split = detail::split_matrix_market_entries(pool, header);
+    detail::CompressedCells<T> cells;
+    if (header.coordinate) {
+        cells = detail::read_matrix_market_coordinates<T>(pool, header, split, F == SparseFormat::ROW);
+    } else {
+        cells = detail::read_matrix_market_array<T>(pool, header, split);
+        if constexpr (F == SparseFormat::ROW) {
+            cells = detail::sparse_transpose(cells, header.rows);
+        }
+    }
+    return SparseMatrix<T, F>(
+        header.rows, header.cols, std::move(cells.offsets), std::move(cells.indices), std::move(cells.values)
+    );
+}
+
+// writes any kind of Matrix to a Matrix Market file in array format,
+// formatting chunks of cells with the given execution policy
+template <execution::ExecutionPolicy Policy, MatrixLike X>
+void save_matrix_market(const Policy& policy, const std::filesystem::path& path, const X& matrix) {
+    using T = typename X::value_type;
+    static_assert(detail::TextCell<T>, "Matrix element type can't be written as text");
+    constexpr Layout L = detail::layout_of_v<X>;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (not file) {
+        throw std::runtime_error("Matrix file can't be opened");
+    }
+    const std::size_t rows = matrix.row_count();
+    const std::size_t cols = matrix.col_count();
+    file << "%%MatrixMarket matrix array " << detail::matrix_market_field_name<T>() << " general\n";
+    file << rows << ' ' << cols << '\n';
+    auto cells = matrix.contents();
+    detail::write_text(
+        detail::execution_pool(policy), file, rows * cols, detail::TEXT_CHUNK_ITEMS,
+        [&](std::size_t begin, std::size_t end, std::string& out) {
+            // the cells of an array are listed column by column
+            for (std::size_t c = begin; c < end; c++) {
+                detail::append_number(out, cells[detail::cell_index<L>(c % rows, c / rows, rows, cols)]);
+                out += '\n';
+            }
+        }
+    );
+}
+
+// writes a SparseMatrix to a Matrix Market file in coordinate format, listing
+// the cells it stores, formatting chunks of them with the given execution
+// policy
+template <execution::ExecutionPolicy Policy, typename T, SparseFormat F>
+void save_matrix_market(const Policy& policy, const std::filesystem::path& path, const SparseMatrix<T, F>& matrix) {
+    static_assert(detail::TextCell<T>, "Matrix element type can't be written as text");
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (not file) {
+        throw std::runtime_error("Matrix file can't be opened");
+    }
+    file << "%%MatrixMarket matrix coordinate " << detail::matrix_market_field_name<T>() << " general\n";
+    file << matrix.row_count() << ' ' << matrix.col_count() << ' ' << matrix.non_zero_count() << '\n';
+    auto offsets = matrix.offsets();
+    auto indices = matrix.indices();
+    auto values = matrix.values();
+    const std::size_t lines = offsets.size() - 1;
+    // chunks of rows (CSR) or columns (CSC) with the cells of about one chunk
+    // of cells between them, on average
+    const std::size_t lines_per_chunk = std::max<std::size_t>(
+        detail::TEXT_CHUNK_ITEMS * lines / std::max<std::size_t>(matrix.non_zero_count(), 1), 1
+    );
+    detail::write_text(
+        detail::execution_pool(policy), file, lines, lines_per_chunk,
+        [&](std::size_t begin, std::size_t end, std::string& out) {
+            for (std::size_t i = begin; i < end; i++) {
+                for (std::size_t c = offsets[i]; c < offsets[i + 1]; c++) {
+                    // indices count from one
+                    detail::append_number(out, (F == SparseFormat::ROW ? i : indices[c]) + 1);
+                    out += ' ';
+                    detail::append_number(out, (F == SparseFormat::ROW ? indices[c] : i) + 1);
+                    out += ' ';
+                    detail::append_number(out, values[c]);
+                    out += '\n';
+                }
+            }
+        }
+    );
+}
+} // namespace com::saxbophone::gryde
+#endif // include guard
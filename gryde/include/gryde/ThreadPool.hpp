@@ -0,0 +1,186 @@
+#ifndef COM_SAXBOPHONE_GRYDE_THREAD_POOL_HPP
+#define COM_SAXBOPHONE_GRYDE_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+namespace com::saxbophone::gryde {
+// fixed set of worker threads which run the iterations of parallel loops,
+// each worker has its own queue of tasks and steals from the others' queues
+// when it runs out, so uneven tasks still keep every worker busy
+// the thread calling parallel_for() works on the loop too, so a pool with no
+// workers runs loops serially, and loops can be nested without deadlocking
+class ThreadPool {
+public:
+    // creates a pool with the given number of worker threads
+    explicit ThreadPool(std::size_t workers)
+      : _queues(workers)
+      , _queued(0)
+      , _stopping(false)
+      {
+        _threads.reserve(workers);
+        for (std::size_t i = 0; i < workers; i++) {
+            _threads.emplace_back([this, i] { this->_work(i); });
+        }
+    }
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    // waits for the workers to finish their current tasks and stops them
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(_sleep_mutex);
+            _stopping = true;
+        }
+        _wake.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+    // number of worker threads, not counting threads calling parallel_for()
+    std::size_t worker_count() const { return _threads.size(); }
+    // calls body(i) for each i in [0, count), spread across the pool, and
+    // returns once they've all finished
+    // if any of the calls throw, the first exception is rethrown from here
+    void parallel_for(std::size_t count, std::function<void(std::size_t)> body) {
+        if (count == 0) {
+            return;
+        }
+        Job job(std::move(body), count);
+        // counted before they're queued, so that taking them can never take
+        // the count below zero
+        if (not _queues.empty()) {
+            std::lock_guard lock(_sleep_mutex);
+            _queued += count;
+        }
+        // deal out the iterations round-robin, stealing evens out the rest
+        for (std::size_t i = 0; i < count; i++) {
+            if (_queues.empty()) {
+                _run(Task{&job, i});
+            } else {
+                Queue& queue = _queues[i % _queues.size()];
+                std::lock_guard lock(queue.mutex);
+                queue.tasks.push_back(Task{&job, i});
+            }
+        }
+        if (not _queues.empty()) {
+            _wake.notify_all();
+        }
+        // help out until there are no tasks left to take, then wait for the
+        // ones still running on workers
+        Task task;
+        while (job.remaining.load() != 0 and _take(0, task)) {
+            _run(task);
+        }
+        {
+            // also makes sure the last worker is done with the job before it's destroyed
+            std::unique_lock lock(job.mutex);
+            job.done.wait(lock, [&job] { return job.remaining.load() == 0; });
+        }
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+    }
+private:
+    // one call to parallel_for()
+    struct Job {
+        Job(std::function<void(std::size_t)> body, std::size_t count)
+          : body(std::move(body))
+          , remaining(count)
+          {}
+        std::function<void(std::size_t)> body;
+        std::atomic<std::size_t> remaining;
+        std::mutex mutex;
+        std::condition_variable done;
+        std::exception_ptr error;
+    };
+
+    // one iteration of a parallel_for()
+    struct Task {
+        Job* job;
+        std::size_t index;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // takes a task from the back of queue first, otherwise steals one from
+    // the front of one of the other queues
+    bool _take(std::size_t first, Task& task) {
+        for (std::size_t i = 0; i < _queues.size(); i++) {
+            Queue& queue = _queues[(first + i) % _queues.size()];
+            std::lock_guard lock(queue.mutex);
+            if (not queue.tasks.empty()) {
+                if (i == 0) {
+                    task = queue.tasks.back();
+                    queue.tasks.pop_back();
+                } else {
+                    task = queue.tasks.front();
+                    queue.tasks.pop_front();
+                }
+                _queued--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void _run(Task task) {
+        Job& job = *task.job;
+        std::exception_ptr error;
+        try {
+            job.body(task.index);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        std::lock_guard lock(job.mutex);
+        if (error and not job.error) {
+            job.error = error;
+        }
+        if (job.remaining.fetch_sub(1) == 1) {
+            job.done.notify_all();
+        }
+    }
+
+    void _work(std::size_t worker) {
+        while (true) {
+            Task task;
+            if (_take(worker, task)) {
+                _run(task);
+                continue;
+            }
+            std::unique_lock lock(_sleep_mutex);
+            _wake.wait(lock, [this] { return _stopping or _queued.load() != 0; });
+            if (_stopping) {
+                return;
+            }
+        }
+    }
+
+    std::vector<Queue> _queues;
+    std::vector<std::thread> _threads;
+    // number of tasks in all the queues, workers sleep when there are none
+    std::atomic<std::size_t> _queued;
+    std::mutex _sleep_mutex;
+    std::condition_variable _wake;
+    bool _stopping;
+};
+
+// a pool shared by the whole program, with a worker for each hardware thread
+// apart from the one calling parallel_for(), created on first use
+inline ThreadPool& default_thread_pool() {
+    static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+    return pool;
+}
+} // namespace com::saxbophone::gryde
+#endif // include guard
@@ -0,0 +1,410 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_BATCH_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_BATCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <gryde/AlignedAllocator.hpp>
+#include <gryde/ThreadPool.hpp>
+#include <gryde/detail/Determinant.hpp>
+#include <gryde/detail/Lu.hpp>
+#include <gryde/detail/Simd.hpp>
+
+// kernels applying one operation to each of a batch of small fixed-size
+// matrices, vectorised across the batch so that each lane of a vector holds
+// the same cell of a different Matrix
+// NOTE: this is an implementation detail, not part of the public API
+//
+// the kernels work on batches laid out structure-of-arrays, where cell c of
+// Matrix i is at cells[c * stride + i], so that the vectors are loaded and
+// stored whole. batches of Matrix objects are transposed into that layout a
+// tile at a time on the way in, and back again on the way out
+//
+// like the element-wise kernels, these are written once with GCC/Clang vector
+// extensions and compiled for each x86 instruction set with target attributes
+namespace com::saxbophone::gryde::detail {
+    // matrices per task when a batch is spread across a thread pool
+    inline constexpr std::size_t BATCH_CHUNK_SIZE = 1024;
+    // matrices transposed into structure-of-arrays layout at a time
+    inline constexpr std::size_t BATCH_TILE_SIZE = 64;
+    // largest number of rows or columns of matrices whose operations are
+    // vectorised across the batch, larger ones are done one at a time (it's
+    // cofactor expansion for determinants and inverses, which grows quickly)
+    inline constexpr std::size_t BATCH_VECTORISED_MAX_SIZE = 4;
+
+    // operations that the batch kernels implement
+    enum class BatchOperation {
+        MULTIPLY,
+        DETERMINANT,
+        INVERSE,
+    };
+
+    // whether OP on M * N (and N * P) matrices is vectorised across the batch
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P>
+    inline constexpr bool is_batch_vectorised_v =
+        M > 0 and M <= BATCH_VECTORISED_MAX_SIZE and
+        N > 0 and N <= BATCH_VECTORISED_MAX_SIZE and
+        (OP != BatchOperation::MULTIPLY or (P > 0 and P <= BATCH_VECTORISED_MAX_SIZE));
+
+    // number of cells in each Matrix resulting from OP
+    template <BatchOperation OP, std::size_t M, std::size_t P>
+    inline constexpr std::size_t BATCH_RESULT_CELLS =
+        OP == BatchOperation::MULTIPLY ? M * P : OP == BatchOperation::DETERMINANT ? 1 : M * M;
+
+    // whether determinants of N * N matrices of T are overflow-checked by
+    // Matrix::determinant(), which the batch kernels have to match
+    template <typename T, std::size_t N>
+    inline constexpr bool is_checked_determinant_v = is_exact_integer_v<T> and N >= ELIMINATION_DETERMINANT_MIN_SIZE;
+
+    // largest magnitude of the cells of N * N integer matrices whose
+    // determinants can't overflow T by cofactor expansion, nor overflow the
+    // widened intermediates of the elimination Matrix::determinant() uses, so
+    // that both give the same exact result
+    template <typename T, std::size_t N>
+    constexpr std::intmax_t cofactor_determinant_bound() {
+        // no term of the expansion, nor any sum of them, exceeds N! * B^N, and
+        // no product in the elimination exceeds the square of that, so the
+        // limit is one whose square, doubled, still fits in intmax_t
+        std::intmax_t limit = std::numeric_limits<std::int32_t>::max();
+        if (static_cast<std::uintmax_t>(std::numeric_limits<T>::max()) < static_cast<std::uintmax_t>(limit)) {
+            limit = static_cast<std::intmax_t>(std::numeric_limits<T>::max());
+        }
+        auto largest_term = [](std::intmax_t bound) {
+            std::intmax_t term = 1;
+            for (std::size_t i = 1; i <= N; i++) {
+                term *= static_cast<std::intmax_t>(i) * bound;
+            }
+            return term;
+        };
+        std::intmax_t bound = 0;
+        while (largest_term(bound + 1) <= limit) {
+            bound++;
+        }
+        return bound;
+    }
+
+    // whether cell is small enough for cofactor_determinant_bound()
+    template <std::size_t N, typename T>
+    constexpr bool is_within_cofactor_bound(T cell) {
+        constexpr std::intmax_t BOUND = cofactor_determinant_bound<T, N>();
+        if constexpr (std::is_signed_v<T>) {
+            return -BOUND <= cell and cell <= BOUND;
+        } else {
+            return cell <= static_cast<std::uintmax_t>(BOUND);
+        }
+    }
+
+    // c = a * b for M * N and N * P row-major cells
+    template <std::size_t M, std::size_t N, std::size_t P, typename V>
+    GRYDE_ALWAYS_INLINE inline void multiply_cells(
+        const std::array<V, M * N>& a, const std::array<V, N * P>& b, std::array<V, M * P>& c
+    ) {
+        for (std::size_t i = 0; i < M; i++) {
+            for (std::size_t j = 0; j < P; j++) {
+                V sum = {};
+                for (std::size_t k = 0; k < N; k++) {
+                    sum += a[i * N + k] * b[k * P + j];
+                }
+                c[i * P + j] = sum;
+            }
+        }
+    }
+
+    // the N * N cells without the given row and column
+    template <std::size_t N, typename V>
+    GRYDE_ALWAYS_INLINE inline void minor_cells(
+        const std::array<V, N * N>& a, std::size_t row, std::size_t col, std::array<V, (N - 1) * (N - 1)>& minor
+    ) {
+        std::size_t i = 0;
+        for (std::size_t m = 0; m < N; m++) {
+            for (std::size_t n = 0; n < N; n++) {
+                if (m != row and n != col) {
+                    minor[i++] = a[m * N + n];
+                }
+            }
+        }
+    }
+
+    // determinant of N * N cells by cofactor expansion along the first row,
+    // which has no branches on the values so that it works lane-wise
+    template <std::size_t N, typename V>
+    GRYDE_ALWAYS_INLINE inline void cofactor_determinant_cells(const std::array<V, N * N>& a, V& determinant) {
+        if constexpr (N == 1) {
+            determinant = a[0];
+        } else if constexpr (N == 2) {
+            determinant = a[0] * a[3] - a[1] * a[2];
+        } else {
+            determinant = V{};
+            for (std::size_t j = 0; j < N; j++) {
+                std::array<V, (N - 1) * (N - 1)> minor;
+                V cofactor;
+                minor_cells<N>(a, 0, j, minor);
+                cofactor_determinant_cells<N - 1>(minor, cofactor);
+                if (j % 2 == 0) {
+                    determinant += a[j] * cofactor;
+                } else {
+                    determinant -= a[j] * cofactor;
+                }
+            }
+        }
+    }
+
+    // adjugate (transposed matrix of cofactors) and determinant of N * N cells
+    template <std::size_t N, typename V>
+    GRYDE_ALWAYS_INLINE inline void adjugate_cells(
+        const std::array<V, N * N>& a, std::array<V, N * N>& adjugate, V& determinant
+    ) {
+        if constexpr (N == 1) {
+            adjugate[0] = V{} + 1;
+        } else {
+            for (std::size_t i = 0; i < N; i++) {
+                for (std::size_t j = 0; j < N; j++) {
+                    std::array<V, (N - 1) * (N - 1)> minor;
+                    V cofactor;
+                    minor_cells<N>(a, i, j, minor);
+                    cofactor_determinant_cells<N - 1>(minor, cofactor);
+                    if ((i + j) % 2 == 0) {
+                        adjugate[j * N + i] = cofactor;
+                    } else {
+                        adjugate[j * N + i] = -cofactor;
+                    }
+                }
+            }
+        }
+        // expansion along the first row reuses the cofactors just found
+        determinant = V{};
+        for (std::size_t j = 0; j < N; j++) {
+            determinant += a[j] * adjugate[j * N];
+        }
+    }
+
+
+    // applies OP to LANES matrices at once, each lane of V holding a cell of a
+    // different Matrix (V may be T itself for one Matrix at a time)
+    // M * N is the size of the a matrices, N * P of the b matrices
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename V, std::size_t LANES, typename T>
+    GRYDE_ALWAYS_INLINE inline void batch_step(
+        const T* a, std::size_t a_stride, const T* b, std::size_t b_stride, T* out, std::size_t out_stride
+    ) {
+        static_assert(sizeof(V) == LANES * sizeof(T));
+        std::array<V, M * N> x;
+        for (std::size_t c = 0; c < M * N; c++) {
+            std::memcpy(&x[c], a + c * a_stride, sizeof(V));
+        }
+        if constexpr (OP == BatchOperation::MULTIPLY) {
+            std::array<V, N * P> y;
+            for (std::size_t c = 0; c < N * P; c++) {
+                std::memcpy(&y[c], b + c * b_stride, sizeof(V));
+            }
+            std::array<V, M * P> z;
+            multiply_cells<M, N, P>(x, y, z);
+            for (std::size_t c = 0; c < M * P; c++) {
+                std::memcpy(out + c * out_stride, &z[c], sizeof(V));
+            }
+        } else if constexpr (OP == BatchOperation::DETERMINANT) {
+            V determinant;
+            cofactor_determinant_cells<M>(x, determinant);
+            std::memcpy(out, &determinant, sizeof(V));
+        } else {
+            std::array<V, M * M> adjugate;
+            V determinant;
+            adjugate_cells<M>(x, adjugate, determinant);
+            T determinants[LANES];
+            std::memcpy(determinants, &determinant, sizeof(V));
+            for (std::size_t lane = 0; lane < LANES; lane++) {
+                if (determinants[lane] == T{}) {
+                    throw std::runtime_error("Matrix is singular");
+                }
+            }
+            for (std::size_t c = 0; c < M * M; c++) {
+                V cell = adjugate[c] / determinant;
+                std::memcpy(out + c * out_stride, &cell, sizeof(V));
+            }
+        }
+    }
+
+    // applies OP to each of count matrices in structure-of-arrays layout, one at a time
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename T>
+    inline void batch_cells_scalar(
+        const T* a, std::size_t a_stride, const T* b, std::size_t b_stride, T* out, std::size_t out_stride,
+        std::size_t count
+    ) {
+        for (std::size_t i = 0; i < count; i++) {
+            batch_step<OP, M, N, P, T, 1>(
+                a + i, a_stride, OP == BatchOperation::MULTIPLY ? b + i : b, b_stride, out + i, out_stride
+            );
+        }
+    }
+
+#if GRYDE_SIMD_DISPATCH
+    // the body of the batch kernel for vectors of WIDTH bytes, inlined into a
+    // wrapper per instruction set which sets the code generation target
+    template <std::size_t WIDTH, BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename T>
+    GRYDE_ALWAYS_INLINE inline void batch_cells_lanes(
+        const T* a, std::size_t a_stride, const T* b, std::size_t b_stride, T* out, std::size_t out_stride,
+        std::size_t count
+    ) {
+        typedef T vector_t [[gnu::vector_size(WIDTH)]];
+        constexpr std::size_t LANES = WIDTH / sizeof(T);
+        std::size_t i = 0;
+        for (; i + LANES <= count; i += LANES) {
+            batch_step<OP, M, N, P, vector_t, LANES>(
+                a + i, a_stride, OP == BatchOperation::MULTIPLY ? b + i : b, b_stride, out + i, out_stride
+            );
+        }
+        // ragged end which doesn't fill a vector
+        for (; i < count; i++) {
+            batch_step<OP, M, N, P, T, 1>(
+                a + i, a_stride, OP == BatchOperation::MULTIPLY ? b + i : b, b_stride, out + i, out_stride
+            );
+        }
+    }
+
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename T>
+    [[gnu::target("sse2")]] inline void batch_cells_sse2(
+        const T* a, std::size_t a_stride, const T* b, std::size_t b_stride, T* out, std::size_t out_stride,
+        std::size_t count
+    ) {
+        batch_cells_lanes<16, OP, M, N, P>(a, a_stride, b, b_stride, out, out_stride, count);
+    }
+
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename T>
+    [[gnu::target("avx2")]] inline void batch_cells_avx2(
+        const T* a, std::size_t a_stride, const T* b, std::size_t b_stride, T* out, std::size_t out_stride,
+        std::size_t count
+    ) {
+        batch_cells_lanes<32, OP, M, N, P>(a, a_stride, b, b_stride, out, out_stride, count);
+    }
+
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename T>
+    [[gnu::target("avx512f")]] inline void batch_cells_avx512(
+        const T* a, std::size_t a_stride, const T* b, std::size_t b_stride, T* out, std::size_t out_stride,
+        std::size_t count
+    ) {
+        batch_cells_lanes<64, OP, M, N, P>(a, a_stride, b, b_stride, out, out_stride, count);
+    }
+#endif
+
+    // applies OP to each of count matrices in structure-of-arrays layout, using
+    // the given instruction set, where cell c of Matrix i of a is at
+    // a[c * a_stride + i], and likewise for b and out
+    // for MULTIPLY, out[i] = a[i] * b[i], with M * N a and N * P b matrices
+    // for DETERMINANT and INVERSE, the M * M a matrices are square, b is unused
+    // and may be null, and INVERSE throws if any of them are singular
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename T>
+    void batch_cells(
+        [[maybe_unused]] simd::Isa isa,
+        const T* a, std::size_t a_stride, const T* b, std::size_t b_stride, T* out, std::size_t out_stride,
+        std::size_t count
+    ) {
+        static_assert(is_batch_vectorised_v<OP, M, N, P>, "Matrix is too large to vectorise across the batch");
+#if GRYDE_SIMD_DISPATCH
+        if constexpr (simd::is_vectorisable_v<T>) {
+            switch (isa) {
+            case simd::Isa::AVX512:
+                return batch_cells_avx512<OP, M, N, P>(a, a_stride, b, b_stride, out, out_stride, count);
+            case simd::Isa::AVX2:
+                return batch_cells_avx2<OP, M, N, P>(a, a_stride, b, b_stride, out, out_stride, count);
+            case simd::Isa::SSE2:
+                return batch_cells_sse2<OP, M, N, P>(a, a_stride, b, b_stride, out, out_stride, count);
+            case simd::Isa::SCALAR:
+                break;
+            }
+        }
+#endif
+        batch_cells_scalar<OP, M, N, P>(a, a_stride, b, b_stride, out, out_stride, count);
+    }
+
+    // applies OP to each of count Matrix objects using the given instruction
+    // set, out[i] receives the resulting Matrix or scalar for a[i] (and b[i])
+    template <BatchOperation OP, std::size_t M, std::size_t N, std::size_t P, typename A, typename B, typename C>
+    void batch(simd::Isa isa, const A* a, const B* b, C* out, std::size_t count) {
+        using T = typename A::value_type;
+        // products of small matrices take less work than transposing them,
+        // so they're only vectorised across batches already laid out in
+        // structure-of-arrays, otherwise each product is vectorised on its own
+        if constexpr (OP == BatchOperation::MULTIPLY or not is_batch_vectorised_v<OP, M, N, P>) {
+            for (std::size_t i = 0; i < count; i++) {
+                if constexpr (OP == BatchOperation::MULTIPLY) {
+                    out[i] = a[i] * b[i];
+                } else if constexpr (OP == BatchOperation::DETERMINANT) {
+                    out[i] = a[i].determinant();
+                } else {
+                    std::array<T, M * M> cells;
+                    std::array<std::size_t, M> pivots;
+                    auto contents = a[i].contents();
+                    std::copy(contents.begin(), contents.end(), cells.begin());
+                    if (not lu_inverse(cells.data(), M, pivots.data(), out[i].contents().data())) {
+                        throw std::runtime_error("Matrix is singular");
+                    }
+                }
+            }
+        } else {
+            constexpr std::size_t TILE = BATCH_TILE_SIZE;
+            constexpr std::size_t RESULT_CELLS = BATCH_RESULT_CELLS<OP, M, P>;
+            alignas(CACHE_LINE_SIZE) std::array<T, M * N * TILE> x;
+            alignas(CACHE_LINE_SIZE) std::array<T, RESULT_CELLS * TILE> z;
+            // checked integer determinants are only vectorised for tiles with
+            // cells too small to overflow, others are done one at a time by
+            // Matrix::determinant() so that they throw the same way
+            constexpr bool CHECKED = OP == BatchOperation::DETERMINANT and is_checked_determinant_v<T, M>;
+            for (std::size_t begin = 0; begin < count; begin += TILE) {
+                const std::size_t size = std::min(TILE, count - begin);
+                [[maybe_unused]] bool exact = true;
+                // transpose the tile into structure-of-arrays layout
+                for (std::size_t i = 0; i < size; i++) {
+                    auto cells = a[begin + i].contents();
+                    for (std::size_t c = 0; c < M * N; c++) {
+                        x[c * TILE + i] = cells[c];
+                        if constexpr (CHECKED) {
+                            exact = exact and is_within_cofactor_bound<M>(cells[c]);
+                        }
+                    }
+                }
+                if constexpr (CHECKED) {
+                    if (not exact) {
+                        for (std::size_t i = 0; i < size; i++) {
+                            out[begin + i] = a[begin + i].determinant();
+                        }
+                        continue;
+                    }
+                }
+                batch_cells<OP, M, N, P>(isa, x.data(), TILE, static_cast<const T*>(nullptr), 0, z.data(), TILE, size);
+                // and the results back again
+                for (std::size_t i = 0; i < size; i++) {
+                    if constexpr (OP == BatchOperation::DETERMINANT) {
+                        out[begin + i] = z[i];
+                    } else {
+                        auto cells = out[begin + i].contents();
+                        for (std::size_t c = 0; c < RESULT_CELLS; c++) {
+                            cells[c] = z[c * TILE + i];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // calls body(begin, end) for consecutive ranges covering [0, count), in
+    // parallel on pool if it's not null and there's enough work to share
+    template <typename Body>
+    void batch_for(ThreadPool* pool, std::size_t count, const Body& body) {
+        if (pool == nullptr or count <= BATCH_CHUNK_SIZE) {
+            body(std::size_t{0}, count);
+            return;
+        }
+        const std::size_t chunks = (count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+        pool->parallel_for(chunks, [&](std::size_t chunk) {
+            const std::size_t begin = chunk * BATCH_CHUNK_SIZE;
+            body(begin, std::min(begin + BATCH_CHUNK_SIZE, count));
+        });
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
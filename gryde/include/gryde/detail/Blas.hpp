@@ -0,0 +1,188 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_BLAS_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_BLAS_HPP
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <gryde/detail/Gemm.hpp>
+
+// when enabled, large float and double products, factorisations and solves are
+// handed off to the system BLAS and LAPACK, which must then be linked in (the
+// GRYDE_USE_BLAS CMake option does this)
+#ifndef GRYDE_USE_BLAS
+#define GRYDE_USE_BLAS 0
+#endif
+
+#if GRYDE_USE_BLAS
+// the Fortran interfaces, which every BLAS and LAPACK provides, rather than
+// CBLAS and LAPACKE, which not all of them do
+// Fortran passes the length of each character argument after all of the
+// others, which gfortran takes as a size_t
+extern "C" {
+    void sgemm_(
+        const char* transa, const char* transb, const int* m, const int* n, const int* k,
+        const float* alpha, const float* a, const int* lda, const float* b, const int* ldb,
+        const float* beta, float* c, const int* ldc,
+        std::size_t transa_length, std::size_t transb_length
+    );
+    void dgemm_(
+        const char* transa, const char* transb, const int* m, const int* n, const int* k,
+        const double* alpha, const double* a, const int* lda, const double* b, const int* ldb,
+        const double* beta, double* c, const int* ldc,
+        std::size_t transa_length, std::size_t transb_length
+    );
+    void strsm_(
+        const char* side, const char* uplo, const char* transa, const char* diag,
+        const int* m, const int* n, const float* alpha, const float* a, const int* lda,
+        float* b, const int* ldb,
+        std::size_t side_length, std::size_t uplo_length, std::size_t transa_length, std::size_t diag_length
+    );
+    void dtrsm_(
+        const char* side, const char* uplo, const char* transa, const char* diag,
+        const int* m, const int* n, const double* alpha, const double* a, const int* lda,
+        double* b, const int* ldb,
+        std::size_t side_length, std::size_t uplo_length, std::size_t transa_length, std::size_t diag_length
+    );
+    void sgetrf_(const int* m, const int* n, float* a, const int* lda, int* ipiv, int* info);
+    void dgetrf_(const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
+}
+#endif
+
+// hand-off of large operations to the system BLAS and LAPACK, where enabled
+// BLAS and LAPACK are column-major, the row-major cells of a Matrix are the
+// column-major cells of its transpose, which is how they're passed to them
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    // whether operations on cells of type T are handed off
+    template <typename T>
+    inline constexpr bool USES_BLAS_V = GRYDE_USE_BLAS and (
+        std::is_same_v<T, float> or std::is_same_v<T, double>
+    );
+    // smaller matrices are left to gryde's own kernels, the call overhead
+    // isn't worth it for them
+    inline constexpr std::size_t BLAS_MIN_SIZE = 64;
+    // the same, for the number of multiply-adds in a product
+    inline constexpr std::size_t BLAS_MIN_MULTIPLY_ADDS = BLAS_MIN_SIZE * BLAS_MIN_SIZE * BLAS_MIN_SIZE;
+
+    // whether all the given dimensions fit the Fortran integer type
+    template <typename... Sizes>
+    constexpr bool fits_blas_int(Sizes... sizes) {
+        return ((sizes <= static_cast<std::size_t>(std::numeric_limits<int>::max())) and ...);
+    }
+
+    // C += A * B for the m * k cells of A and k * n cells of B, into the
+    // row-major cells of C, which are ldc apart
+    // returns false, leaving C alone, if the operands aren't stored so that
+    // BLAS can read them (they must be contiguous along rows or columns)
+    template <typename T, typename A, typename B>
+    requires USES_BLAS_V<T>
+    bool blas_gemm(
+        std::size_t m, std::size_t n, std::size_t k,
+        const A& a, const B& b,
+        T* c, std::size_t ldc
+    ) {
+        if constexpr (not is_strided_cells_v<A> or not is_strided_cells_v<B>) {
+            return false;
+        } else {
+            if (m * n * k < BLAS_MIN_MULTIPLY_ADDS) {
+                return false;
+            }
+            // the transpose operation BLAS needs for an operand and the
+            // distance between its rows (if row-major) or columns
+            auto operand = [](const StridedCells<T>& cells, std::size_t rows, std::size_t cols) {
+                if (cells.col_stride == 1 and cells.row_stride >= std::max<std::size_t>(cols, 1)) {
+                    return std::pair<char, std::size_t>('N', cells.row_stride);
+                }
+                if (cells.row_stride == 1 and cells.col_stride >= std::max<std::size_t>(rows, 1)) {
+                    return std::pair<char, std::size_t>('T', cells.col_stride);
+                }
+                return std::pair<char, std::size_t>('\0', 0);
+            };
+            auto [op_a, lda] = operand(a, m, k);
+            auto [op_b, ldb] = operand(b, k, n);
+            if (op_a == '\0' or op_b == '\0' or not fits_blas_int(m, n, k, lda, ldb, ldc)) {
+                return false;
+            }
+            // C^T += B^T * A^T, in BLAS terms
+            const int rows = static_cast<int>(n);
+            const int cols = static_cast<int>(m);
+            const int depth = static_cast<int>(k);
+            const int ld_a = static_cast<int>(lda);
+            const int ld_b = static_cast<int>(ldb);
+            const int ld_c = static_cast<int>(ldc);
+            const T one = 1;
+            if constexpr (std::is_same_v<T, float>) {
+                sgemm_(&op_b, &op_a, &rows, &cols, &depth, &one, b.data, &ld_b, a.data, &ld_a, &one, c, &ld_c, 1, 1);
+            } else {
+                dgemm_(&op_b, &op_a, &rows, &cols, &depth, &one, b.data, &ld_b, a.data, &ld_a, &one, c, &ld_c, 1, 1);
+            }
+            return true;
+        }
+    }
+
+    // the same as lu_factorise() on the n * n row-major cells at a, by LAPACK
+    // pivots (which must not be null) receives the row swapped with each row
+    // returns the parity of the row permutation (+1 or -1)
+    template <typename T>
+    requires USES_BLAS_V<T>
+    int lapack_factorise(T* a, std::size_t n, std::size_t* pivots) {
+        // LAPACK factorises column-major cells, so transpose in place around it
+        auto transpose = [&] {
+            for (std::size_t i = 0; i < n; i++) {
+                for (std::size_t j = i + 1; j < n; j++) {
+                    std::swap(a[i * n + j], a[j * n + i]);
+                }
+            }
+        };
+        transpose();
+        const int size = static_cast<int>(n);
+        std::vector<int> swaps(n);
+        int info = 0;
+        if constexpr (std::is_same_v<T, float>) {
+            sgetrf_(&size, &size, a, &size, swaps.data(), &info);
+        } else {
+            dgetrf_(&size, &size, a, &size, swaps.data(), &info);
+        }
+        transpose();
+        // a positive info only means that U is singular, it's still complete
+        int parity = 1;
+        for (std::size_t k = 0; k < n; k++) {
+            // LAPACK counts rows from 1
+            pivots[k] = static_cast<std::size_t>(swaps[k] - 1);
+            if (pivots[k] != k) {
+                parity = -parity;
+            }
+        }
+        return parity;
+    }
+
+    // the same as lu_substitute() for all the columns of the n * columns
+    // row-major cells of B, by BLAS triangular solves
+    template <typename T>
+    requires USES_BLAS_V<T>
+    void blas_substitute(const T* lu, std::size_t n, T* b, std::size_t columns) {
+        // BLAS rejects an empty right-hand side, as its leading dimension is zero
+        if (columns == 0) {
+            return;
+        }
+        const int size = static_cast<int>(n);
+        const int width = static_cast<int>(columns);
+        const T one = 1;
+        // in BLAS terms, X^T * L^T = B^T then X^T * U^T = Y^T, where the
+        // transposed triangles are the upper and lower ones of the transposed
+        // row-major factors that BLAS sees
+        if constexpr (std::is_same_v<T, float>) {
+            strsm_("R", "U", "N", "U", &width, &size, &one, lu, &size, b, &width, 1, 1, 1, 1);
+            strsm_("R", "L", "N", "N", &width, &size, &one, lu, &size, b, &width, 1, 1, 1, 1);
+        } else {
+            dtrsm_("R", "U", "N", "U", &width, &size, &one, lu, &size, b, &width, 1, 1, 1, 1);
+            dtrsm_("R", "L", "N", "N", &width, &size, &one, lu, &size, b, &width, 1, 1, 1, 1);
+        }
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
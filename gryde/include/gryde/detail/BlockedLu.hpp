@@ -0,0 +1,178 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_BLOCKED_LU_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_BLOCKED_LU_HPP
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <gryde/ThreadPool.hpp>
+#include <gryde/detail/Blas.hpp>
+#include <gryde/detail/Gemm.hpp>
+#include <gryde/detail/Lu.hpp>
+#include <gryde/detail/ParallelGemm.hpp>
+
+// blocked, multi-threaded LU factorisation for large matrices
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    // columns factorised per panel, the trailing matrix is updated once per panel
+    inline constexpr std::size_t LU_BLOCK_SIZE = 64;
+    // matrices smaller than this are factorised by the unblocked kernel
+    inline constexpr std::size_t LU_BLOCKED_MIN_SIZE = 4 * LU_BLOCK_SIZE;
+    // columns of the block row of U solved for by each task
+    inline constexpr std::size_t LU_SOLVE_COLUMNS = 256;
+
+    // the negated cells of another accessor
+    template <typename Accessor>
+    struct NegatedCells {
+        const Accessor& cells;
+        constexpr auto operator()(std::size_t m, std::size_t n) const {
+            return -cells(m, n);
+        }
+    };
+
+    // unblocked factorisation of the panel of columns [k, k + nb) of the n * n
+    // row-major cells at a, rows are swapped across the whole width of the
+    // matrix so that the columns either side of the panel are kept in step
+    // returns the parity of the row swaps made
+    template <typename T>
+    int lu_factorise_panel(T* a, std::size_t n, std::size_t k, std::size_t nb, std::size_t* pivots) {
+        int parity = 1;
+        for (std::size_t j = k; j < k + nb; j++) {
+            // find the row with the largest magnitude in column j
+            std::size_t pivot = j;
+            T largest = absolute(a[j * n + j]);
+            for (std::size_t i = j + 1; i < n; i++) {
+                T candidate = absolute(a[i * n + j]);
+                if (largest < candidate) {
+                    pivot = i;
+                    largest = candidate;
+                }
+            }
+            pivots[j] = pivot;
+            // column is all zero, nothing to eliminate
+            if (largest == T{}) {
+                continue;
+            }
+            if (pivot != j) {
+                std::swap_ranges(a + j * n, a + j * n + n, a + pivot * n);
+                parity = -parity;
+            }
+            // eliminate column j within the panel only, the rest of the
+            // matrix is updated a whole panel at a time
+            const T diagonal = a[j * n + j];
+            for (std::size_t i = j + 1; i < n; i++) {
+                T factor = a[i * n + j] / diagonal;
+                a[i * n + j] = factor;
+                for (std::size_t c = j + 1; c < k + nb; c++) {
+                    a[i * n + c] -= factor * a[j * n + c];
+                }
+            }
+        }
+        return parity;
+    }
+
+    // in-place right-looking blocked LU factorisation with partial pivoting of
+    // the n * n row-major cells at a, giving the same factors as lu_factorise()
+    // up to rounding
+    // each panel is factorised serially, then the block row of U to its right
+    // is solved for and the trailing matrix updated with GEMM, both in
+    // parallel on pool if it's not null
+    // pivots (which must not be null) receives the row swapped with each row
+    // returns the parity of the row permutation (+1 or -1)
+    template <typename T>
+    int lu_factorise_blocked(T* a, std::size_t n, std::size_t* pivots, ThreadPool* pool) {
+        if constexpr (USES_BLAS_V<T>) {
+            if (n >= BLAS_MIN_SIZE and fits_blas_int(n)) {
+                return lapack_factorise(a, n, pivots);
+            }
+        }
+        if (n < LU_BLOCKED_MIN_SIZE) {
+            return lu_factorise(a, n, pivots);
+        }
+        int parity = 1;
+        for (std::size_t k = 0; k < n; k += LU_BLOCK_SIZE) {
+            const std::size_t nb = std::min(LU_BLOCK_SIZE, n - k);
+            parity *= lu_factorise_panel(a, n, k, nb, pivots);
+            const std::size_t rest = n - k - nb;
+            if (rest == 0) {
+                break;
+            }
+            // U12 = L11^-1 * A12, by forward substitution with the unit lower
+            // triangle of the panel, row-wise so that the inner loop is unit-stride
+            auto solve = [&](std::size_t chunk) {
+                const std::size_t begin = k + nb + chunk * LU_SOLVE_COLUMNS;
+                const std::size_t end = std::min(begin + LU_SOLVE_COLUMNS, n);
+                for (std::size_t i = k; i < k + nb; i++) {
+                    for (std::size_t r = i + 1; r < k + nb; r++) {
+                        const T factor = a[r * n + i];
+                        for (std::size_t c = begin; c < end; c++) {
+                            a[r * n + c] -= factor * a[i * n + c];
+                        }
+                    }
+                }
+            };
+            const std::size_t chunks = (rest + LU_SOLVE_COLUMNS - 1) / LU_SOLVE_COLUMNS;
+            if (pool != nullptr) {
+                pool->parallel_for(chunks, solve);
+            } else {
+                for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+                    solve(chunk);
+                }
+            }
+            // A22 -= L21 * U12
+            StridedCells<T> l21{a + (k + nb) * n + k, n, 1};
+            StridedCells<T> u12{a + k * n + k + nb, n, 1};
+            NegatedCells<StridedCells<T>> negated_l21{l21};
+            T* a22 = a + (k + nb) * n + k + nb;
+            if (pool != nullptr) {
+                parallel_gemm(*pool, rest, rest, nb, negated_l21, u12, a22, n);
+            } else {
+                gemm(rest, rest, nb, negated_l21, u12, a22, n);
+            }
+        }
+        return parity;
+    }
+
+    // determinant of the n * n row-major cells starting at a, destroying them
+    // by blocked factorisation, in parallel on pool if it's not null
+    template <typename T>
+    T lu_determinant_blocked(T* a, std::size_t n, ThreadPool* pool) {
+        std::vector<std::size_t> pivots(n);
+        T product = lu_factorise_blocked(a, n, pivots.data(), pool) < 0 ? T{-1} : T{1};
+        for (std::size_t k = 0; k < n; k++) {
+            product *= a[k * n + k];
+        }
+        return product;
+    }
+
+    // solves A * X = B in place of the n * columns row-major cells of B, given
+    // the factors and pivots of a non-singular A from lu_factorise_blocked()
+    // wide right-hand sides are split into ranges of columns, solved for in
+    // parallel on pool if it's not null
+    template <typename T>
+    void lu_solve_blocked(
+        const T* lu, std::size_t n, const std::size_t* pivots,
+        T* b, std::size_t columns, ThreadPool* pool
+    ) {
+        if constexpr (USES_BLAS_V<T>) {
+            if (n >= BLAS_MIN_SIZE and fits_blas_int(n, columns)) {
+                lu_permute(n, pivots, b, columns);
+                blas_substitute(lu, n, b, columns);
+                return;
+            }
+        }
+        if (pool == nullptr or columns <= LU_SOLVE_COLUMNS) {
+            lu_solve(lu, n, pivots, b, columns);
+            return;
+        }
+        lu_permute(n, pivots, b, columns);
+        const std::size_t chunks = (columns + LU_SOLVE_COLUMNS - 1) / LU_SOLVE_COLUMNS;
+        pool->parallel_for(chunks, [&](std::size_t chunk) {
+            const std::size_t begin = chunk * LU_SOLVE_COLUMNS;
+            lu_substitute(lu, n, b, columns, begin, std::min(begin + LU_SOLVE_COLUMNS, columns));
+        });
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
@@ -0,0 +1,138 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_CLOSED_FORM_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_CLOSED_FORM_HPP
+
+#include <utility>
+
+#include <cstddef>
+
+// fully unrolled, closed-form kernels for the small fixed-size matrices that
+// make up most graphics and robotics work
+// NOTE: this is an implementation detail, not part of the public API
+//
+// they're straight-line code with no loops or branches on the values, which
+// the compiler keeps in registers and vectorises by itself (with shuffles
+// between the lanes where needed), while staying usable in constant
+// expressions, which explicit SIMD intrinsics aren't
+namespace com::saxbophone::gryde::detail {
+    // largest number of rows or columns of matrices with closed-form kernels
+    inline constexpr std::size_t CLOSED_FORM_MAX_SIZE = 4;
+
+    // whether an extent is small enough for the closed-form kernels
+    inline constexpr bool is_closed_form_extent(std::size_t extent) {
+        return extent > 0 and extent <= CLOSED_FORM_MAX_SIZE;
+    }
+
+    // dot product of a row of N cells and a column of cells P apart
+    template <std::size_t N, std::size_t P, typename T>
+    constexpr T unrolled_dot(const T* row, const T* col) {
+        return [&]<std::size_t... K>(std::index_sequence<K...>) {
+            return ((row[K] * col[K * P]) + ...);
+        }(std::make_index_sequence<N>{});
+    }
+
+    // c = a * b for M * N and N * P row-major cells
+    template <std::size_t M, std::size_t N, std::size_t P, typename T>
+    constexpr void unrolled_multiply(const T* a, const T* b, T* c) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((c[I] = unrolled_dot<N, P>(a + (I / P) * N, b + I % P)), ...);
+        }(std::make_index_sequence<M * P>{});
+    }
+
+    // out = the transpose of the M * N row-major cells at a
+    template <std::size_t M, std::size_t N, typename T>
+    constexpr void unrolled_transpose(const T* a, T* out) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((out[(I % N) * M + I / N] = a[I]), ...);
+        }(std::make_index_sequence<M * N>{});
+    }
+
+    // determinant of the N * N row-major cells at a, for N from 1 to 4
+    template <std::size_t N, typename T>
+    constexpr T closed_form_determinant(const T* a) {
+        static_assert(is_closed_form_extent(N));
+        if constexpr (N == 1) {
+            return a[0];
+        } else if constexpr (N == 2) {
+            return a[0] * a[3] - a[1] * a[2];
+        } else if constexpr (N == 3) {
+            return a[0] * (a[4] * a[8] - a[5] * a[7])
+                 - a[1] * (a[3] * a[8] - a[5] * a[6])
+                 + a[2] * (a[3] * a[7] - a[4] * a[6]);
+        } else {
+            // Laplace expansion by the 2x2 minors of the top and bottom halves
+            const T s0 = a[0] * a[5] - a[4] * a[1];
+            const T s1 = a[0] * a[6] - a[4] * a[2];
+            const T s2 = a[0] * a[7] - a[4] * a[3];
+            const T s3 = a[1] * a[6] - a[5] * a[2];
+            const T s4 = a[1] * a[7] - a[5] * a[3];
+            const T s5 = a[2] * a[7] - a[6] * a[3];
+            const T c5 = a[10] * a[15] - a[14] * a[11];
+            const T c4 = a[9] * a[15] - a[13] * a[11];
+            const T c3 = a[9] * a[14] - a[13] * a[10];
+            const T c2 = a[8] * a[15] - a[12] * a[11];
+            const T c1 = a[8] * a[14] - a[12] * a[10];
+            const T c0 = a[8] * a[13] - a[12] * a[9];
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    }
+
+    // adjugate of the N * N row-major cells at a into out, for N from 1 to 4
+    // returns the determinant, so the inverse is the adjugate divided by it
+    template <std::size_t N, typename T>
+    constexpr T closed_form_adjugate(const T* a, T* out) {
+        static_assert(is_closed_form_extent(N));
+        if constexpr (N == 1) {
+            out[0] = T{1};
+            return a[0];
+        } else if constexpr (N == 2) {
+            out[0] = a[3];
+            out[1] = -a[1];
+            out[2] = -a[2];
+            out[3] = a[0];
+            return a[0] * a[3] - a[1] * a[2];
+        } else if constexpr (N == 3) {
+            out[0] = a[4] * a[8] - a[5] * a[7];
+            out[1] = a[2] * a[7] - a[1] * a[8];
+            out[2] = a[1] * a[5] - a[2] * a[4];
+            out[3] = a[5] * a[6] - a[3] * a[8];
+            out[4] = a[0] * a[8] - a[2] * a[6];
+            out[5] = a[2] * a[3] - a[0] * a[5];
+            out[6] = a[3] * a[7] - a[4] * a[6];
+            out[7] = a[1] * a[6] - a[0] * a[7];
+            out[8] = a[0] * a[4] - a[1] * a[3];
+            return a[0] * out[0] + a[1] * out[3] + a[2] * out[6];
+        } else {
+            // the same 2x2 minors as the determinant, each used several times
+            const T s0 = a[0] * a[5] - a[4] * a[1];
+            const T s1 = a[0] * a[6] - a[4] * a[2];
+            const T s2 = a[0] * a[7] - a[4] * a[3];
+            const T s3 = a[1] * a[6] - a[5] * a[2];
+            const T s4 = a[1] * a[7] - a[5] * a[3];
+            const T s5 = a[2] * a[7] - a[6] * a[3];
+            const T c5 = a[10] * a[15] - a[14] * a[11];
+            const T c4 = a[9] * a[15] - a[13] * a[11];
+            const T c3 = a[9] * a[14] - a[13] * a[10];
+            const T c2 = a[8] * a[15] - a[12] * a[11];
+            const T c1 = a[8] * a[14] - a[12] * a[10];
+            const T c0 = a[8] * a[13] - a[12] * a[9];
+            out[0] = a[5] * c5 - a[6] * c4 + a[7] * c3;
+            out[1] = -a[1] * c5 + a[2] * c4 - a[3] * c3;
+            out[2] = a[13] * s5 - a[14] * s4 + a[15] * s3;
+            out[3] = -a[9] * s5 + a[10] * s4 - a[11] * s3;
+            out[4] = -a[4] * c5 + a[6] * c2 - a[7] * c1;
+            out[5] = a[0] * c5 - a[2] * c2 + a[3] * c1;
+            out[6] = -a[12] * s5 + a[14] * s2 - a[15] * s1;
+            out[7] = a[8] * s5 - a[10] * s2 + a[11] * s1;
+            out[8] = a[4] * c4 - a[5] * c2 + a[7] * c0;
+            out[9] = -a[0] * c4 + a[1] * c2 - a[3] * c0;
+            out[10] = a[12] * s4 - a[13] * s2 + a[15] * s0;
+            out[11] = -a[8] * s4 + a[9] * s2 - a[11] * s0;
+            out[12] = -a[4] * c3 + a[5] * c1 - a[6] * c0;
+            out[13] = a[0] * c3 - a[1] * c1 + a[2] * c0;
+            out[14] = -a[12] * s3 + a[13] * s1 - a[14] * s0;
+            out[15] = a[8] * s3 - a[9] * s1 + a[10] * s0;
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
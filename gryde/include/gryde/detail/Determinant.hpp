@@ -0,0 +1,243 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_DETERMINANT_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_DETERMINANT_HPP
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gryde/detail/Lu.hpp>
+
+// elimination-based determinant kernels shared by all Matrix types
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    // matrices smaller than this have their determinants calculated by cofactor
+    // expansion, which is exact and cheap enough at these sizes
+    inline constexpr std::size_t ELIMINATION_DETERMINANT_MIN_SIZE = 4;
+
+    // cofactor expansion uses a bitmask to track which columns are in use
+    inline constexpr std::size_t COFACTOR_DETERMINANT_MAX_SIZE = 64;
+
+    // element types which get exact determinants by fraction-free elimination
+    template <typename T>
+    inline constexpr bool is_exact_integer_v = std::is_integral_v<T> and not std::is_same_v<T, bool>;
+
+    // overflow-checked arithmetic on the widened intermediates of Bareiss
+    // written out by hand rather than with compiler builtins so that it works
+    // on all compilers and in constant expressions
+    constexpr std::intmax_t checked_multiply(std::intmax_t a, std::intmax_t b) {
+        constexpr std::intmax_t MAX = std::numeric_limits<std::intmax_t>::max();
+        constexpr std::intmax_t MIN = std::numeric_limits<std::intmax_t>::min();
+        bool overflows = false;
+        if (a > 0) {
+            overflows = b > 0 ? a > MAX / b : b < MIN / a;
+        } else if (a < 0) {
+            overflows = b > 0 ? a < MIN / b : b < 0 and a < MAX / b;
+        }
+        if (overflows) {
+            throw std::overflow_error("Integer overflow calculating determinant");
+        }
+        return a * b;
+    }
+
+    constexpr std::intmax_t checked_subtract(std::intmax_t a, std::intmax_t b) {
+        constexpr std::intmax_t MAX = std::numeric_limits<std::intmax_t>::max();
+        constexpr std::intmax_t MIN = std::numeric_limits<std::intmax_t>::min();
+        if ((b > 0 and a < MIN + b) or (b < 0 and a > MAX + b)) {
+            throw std::overflow_error("Integer overflow calculating determinant");
+        }
+        return a - b;
+    }
+
+    constexpr std::intmax_t checked_divide(std::intmax_t a, std::intmax_t b) {
+        if (b == -1 and a == std::numeric_limits<std::intmax_t>::min()) {
+            throw std::overflow_error("Integer overflow calculating determinant");
+        }
+        return a / b;
+    }
+
+    // exact determinant of the n * n row-major integer cells by Bareiss'
+    // fraction-free elimination, which keeps every intermediate an integer
+    // (each one is the determinant of a minor of the original matrix)
+    // scratch must have room for n * n widened cells
+    // throws std::overflow_error if an intermediate doesn't fit in intmax_t or
+    // if the result doesn't fit in a signed T (unsigned T wraps, as it does
+    // for all other arithmetic on unsigned types)
+    template <typename T>
+    constexpr T bareiss_determinant(std::span<const T> cells, std::intmax_t* scratch, std::size_t n) {
+        if (n == 0) {
+            return T{1};
+        }
+        for (std::size_t i = 0; i < n * n; i++) {
+            if constexpr (std::is_unsigned_v<T> and sizeof(T) >= sizeof(std::intmax_t)) {
+                if (cells[i] > static_cast<T>(std::numeric_limits<std::intmax_t>::max())) {
+                    throw std::overflow_error("Integer overflow calculating determinant");
+                }
+            }
+            scratch[i] = static_cast<std::intmax_t>(cells[i]);
+        }
+        std::intmax_t* a = scratch;
+        std::intmax_t sign = 1;
+        std::intmax_t previous = 1;
+        for (std::size_t k = 0; k + 1 < n; k++) {
+            // need a non-zero pivot, swap one up from below if needed
+            if (a[k * n + k] == 0) {
+                std::size_t pivot = k + 1;
+                while (pivot < n and a[pivot * n + k] == 0) {
+                    pivot++;
+                }
+                // column is all zero below the diagonal, so Matrix is singular
+                if (pivot == n) {
+                    return T{};
+                }
+                for (std::size_t j = k; j < n; j++) {
+                    std::swap(a[k * n + j], a[pivot * n + j]);
+                }
+                sign = -sign;
+            }
+            for (std::size_t i = k + 1; i < n; i++) {
+                for (std::size_t j = k + 1; j < n; j++) {
+                    // this division is always exact
+                    a[i * n + j] = checked_divide(
+                        checked_subtract(
+                            checked_multiply(a[i * n + j], a[k * n + k]),
+                            checked_multiply(a[i * n + k], a[k * n + j])
+                        ),
+                        previous
+                    );
+                }
+            }
+            previous = a[k * n + k];
+        }
+        std::intmax_t determinant = checked_multiply(sign, a[n * n - 1]);
+        if constexpr (std::is_signed_v<T> and sizeof(T) < sizeof(std::intmax_t)) {
+            if (
+                determinant < std::numeric_limits<T>::min() or
+                determinant > std::numeric_limits<T>::max()
+            ) {
+                throw std::overflow_error("Determinant is too large for Matrix element type");
+            }
+        }
+        return static_cast<T>(determinant);
+    }
+
+    // determinant of the n * n row-major cells by cofactor expansion, for
+    // element types which can't be eliminated
+    // works on the original cells throughout, recursing on the rows below row
+    // and the columns not set in the used bitmask, so no submatrices are built
+    template <typename T>
+    constexpr T cofactor_determinant(
+        std::span<const T> cells,
+        std::size_t n,
+        std::size_t row = 0,
+        std::uint64_t used = 0
+    ) {
+        if (row == n) {
+            return T{1};
+        }
+        T sum = {};
+        bool add = true;
+        for (std::size_t col = 0; col < n; col++) {
+            const std::uint64_t bit = std::uint64_t{1} << col;
+            if ((used & bit) != 0) { continue; }
+            T minor = cofactor_determinant(cells, n, row + 1, used | bit);
+            // alternate between adding and subtracting each remaining column
+            if (add) {
+                sum += cells[row * n + col] * minor;
+            } else {
+                sum -= cells[row * n + col] * minor;
+            }
+            add = not add;
+        }
+        return sum;
+    }
+
+    // rank of the rows * cols row-major floating-point cells, by Gaussian
+    // elimination with partial pivoting, destroying them
+    // pivots no larger than a tolerance scaled by the largest cell and the
+    // size of the Matrix count as zero, to absorb rounding errors
+    template <typename T>
+    constexpr std::size_t lu_rank(T* a, std::size_t rows, std::size_t cols) {
+        T largest = {};
+        for (std::size_t i = 0; i < rows * cols; i++) {
+            largest = std::max(largest, absolute(a[i]));
+        }
+        const T tolerance = largest * std::numeric_limits<T>::epsilon() * static_cast<T>(std::max(rows, cols));
+        std::size_t rank = 0;
+        for (std::size_t k = 0; k < cols and rank < rows; k++) {
+            std::size_t pivot = rank;
+            for (std::size_t i = rank + 1; i < rows; i++) {
+                if (absolute(a[pivot * cols + k]) < absolute(a[i * cols + k])) {
+                    pivot = i;
+                }
+            }
+            if (not (tolerance < absolute(a[pivot * cols + k]))) { continue; }
+            for (std::size_t j = k; j < cols; j++) {
+                std::swap(a[rank * cols + j], a[pivot * cols + j]);
+            }
+            for (std::size_t i = rank + 1; i < rows; i++) {
+                T factor = a[i * cols + k] / a[rank * cols + k];
+                for (std::size_t j = k + 1; j < cols; j++) {
+                    a[i * cols + j] -= factor * a[rank * cols + j];
+                }
+            }
+            rank++;
+        }
+        return rank;
+    }
+
+    // exact rank of the rows * cols row-major integer cells, by reducing them
+    // to row echelon form with Bareiss' fraction-free elimination
+    // scratch must have room for rows * cols widened cells
+    template <typename T>
+    constexpr std::size_t bareiss_rank(
+        std::span<const T> cells,
+        std::intmax_t* scratch,
+        std::size_t rows,
+        std::size_t cols
+    ) {
+        for (std::size_t i = 0; i < rows * cols; i++) {
+            if constexpr (std::is_unsigned_v<T> and sizeof(T) >= sizeof(std::intmax_t)) {
+                if (cells[i] > static_cast<T>(std::numeric_limits<std::intmax_t>::max())) {
+                    throw std::overflow_error("Integer overflow calculating rank");
+                }
+            }
+            scratch[i] = static_cast<std::intmax_t>(cells[i]);
+        }
+        std::intmax_t* a = scratch;
+        std::intmax_t previous = 1;
+        std::size_t rank = 0;
+        for (std::size_t k = 0; k < cols and rank < rows; k++) {
+            std::size_t pivot = rank;
+            while (pivot < rows and a[pivot * cols + k] == 0) {
+                pivot++;
+            }
+            if (pivot == rows) { continue; }
+            for (std::size_t j = k; j < cols; j++) {
+                std::swap(a[rank * cols + j], a[pivot * cols + j]);
+            }
+            for (std::size_t i = rank + 1; i < rows; i++) {
+                for (std::size_t j = k + 1; j < cols; j++) {
+                    // this division is always exact
+                    a[i * cols + j] = checked_divide(
+                        checked_subtract(
+                            checked_multiply(a[i * cols + j], a[rank * cols + k]),
+                            checked_multiply(a[i * cols + k], a[rank * cols + j])
+                        ),
+                        previous
+                    );
+                }
+                a[i * cols + k] = 0;
+            }
+            previous = a[rank * cols + k];
+            rank++;
+        }
+        return rank;
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
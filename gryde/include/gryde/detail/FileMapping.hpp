@@ -0,0 +1,113 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_FILE_MAPPING_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_FILE_MAPPING_HPP
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <cstddef>
+
+#if defined(__unix__) or defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define COM_SAXBOPHONE_GRYDE_POSIX_MAPPING 1
+#else
+#define COM_SAXBOPHONE_GRYDE_POSIX_MAPPING 0
+#endif
+
+// the contents of a whole file in memory, mapped where the platform allows it
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    class FileMapping {
+    public:
+        // maps nothing
+        FileMapping() = default;
+        // maps the file at path, writes to the mapping are never written back
+        // to the file, and are only allowed if writable is set
+        // pages of the file are only read in when they're first accessed
+        FileMapping(const std::filesystem::path& path, bool writable) {
+#if COM_SAXBOPHONE_GRYDE_POSIX_MAPPING
+            int file = ::open(path.c_str(), O_RDONLY);
+            if (file < 0) {
+                throw std::runtime_error("Matrix file can't be opened");
+            }
+            struct stat status = {};
+            if (::fstat(file, &status) != 0) {
+                ::close(file);
+                throw std::runtime_error("Matrix file can't be opened");
+            }
+            _size = static_cast<std::size_t>(status.st_size);
+            if (_size != 0) {
+                // private mappings give copy-on-write pages when writable
+                void* data = ::mmap(
+                    nullptr, _size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                    MAP_PRIVATE, file, 0
+                );
+                if (data == MAP_FAILED) {
+                    ::close(file);
+                    throw std::runtime_error("Matrix file can't be mapped");
+                }
+                _data = static_cast<std::byte*>(data);
+            }
+            // the mapping stays valid without the file descriptor
+            ::close(file);
+#else
+            // no mapping, so read the whole file into memory instead
+            (void)writable;
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (not file) {
+                throw std::runtime_error("Matrix file can't be opened");
+            }
+            _size = static_cast<std::size_t>(file.tellg());
+            _buffer = std::make_unique<std::byte[]>(_size);
+            file.seekg(0);
+            if (not file.read(reinterpret_cast<char*>(_buffer.get()), static_cast<std::streamsize>(_size))) {
+                throw std::runtime_error("Matrix file can't be read");
+            }
+            _data = _buffer.get();
+#endif
+        }
+        FileMapping(const FileMapping&) = delete;
+        FileMapping& operator=(const FileMapping&) = delete;
+        FileMapping(FileMapping&& other) noexcept {
+            *this = std::move(other);
+        }
+        FileMapping& operator=(FileMapping&& other) noexcept {
+            if (this != &other) {
+                _unmap();
+                _data = std::exchange(other._data, nullptr);
+                _size = std::exchange(other._size, 0);
+#if not COM_SAXBOPHONE_GRYDE_POSIX_MAPPING
+                _buffer = std::move(other._buffer);
+#endif
+            }
+            return *this;
+        }
+        ~FileMapping() {
+            _unmap();
+        }
+        std::byte* data() const { return _data; }
+        std::size_t size() const { return _size; }
+    private:
+        void _unmap() {
+#if COM_SAXBOPHONE_GRYDE_POSIX_MAPPING
+            if (_data != nullptr) {
+                ::munmap(_data, _size);
+            }
+#endif
+            _data = nullptr;
+            _size = 0;
+        }
+
+        std::byte* _data = nullptr;
+        std::size_t _size = 0;
+#if not COM_SAXBOPHONE_GRYDE_POSIX_MAPPING
+        std::unique_ptr<std::byte[]> _buffer;
+#endif
+    };
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
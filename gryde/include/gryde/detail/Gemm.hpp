@@ -0,0 +1,242 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_GEMM_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_GEMM_HPP
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+// general matrix-matrix multiplication engine shared by all Matrix types
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    // read-only window onto a block of cells laid out with arbitrary strides
+    // (row-major storage has col_stride == 1, column-major has row_stride == 1)
+    template <typename T>
+    struct StridedCells {
+        const T* data;
+        std::size_t row_stride;
+        std::size_t col_stride;
+        constexpr const T& operator()(std::size_t m, std::size_t n) const {
+            return data[m * row_stride + n * col_stride];
+        }
+    };
+
+    // blocking parameters for the cache-blocked multiply
+    // register tile computed by the micro-kernel: GEMM_MR rows * GEMM_NR cols
+    inline constexpr std::size_t GEMM_MR = 4;
+    inline constexpr std::size_t GEMM_NR = 8;
+    // depth of packed panels, sized so one packed B micro-panel stays in L1
+    inline constexpr std::size_t GEMM_KC = 256;
+    // rows of packed A block, sized so the packed A block stays in L2
+    inline constexpr std::size_t GEMM_MC = 128;
+    // cols of packed B block, sized so the packed B block stays in L3
+    inline constexpr std::size_t GEMM_NC = 4096;
+    // below this many multiply-adds, packing costs more than it saves
+    inline constexpr std::size_t GEMM_SMALL_SIZE = 32 * 32 * 32;
+
+    template <typename X>
+    inline constexpr bool is_strided_cells_v = false;
+
+    template <typename T>
+    inline constexpr bool is_strided_cells_v<StridedCells<T>> = true;
+
+    // C += A * B without any blocking, in i-k-j order so the inner loop is
+    // unit-stride over rows of B and C
+    // when A is stored by rows and B by columns, in i-j-k order instead, as dot
+    // products of unit-stride rows of A and columns of B
+    template <typename T, typename A, typename B>
+    constexpr void gemm_simple(
+        std::size_t m, std::size_t n, std::size_t k,
+        const A& a, const B& b,
+        T* c, std::size_t ldc
+    ) {
+        if constexpr (is_strided_cells_v<A> and is_strided_cells_v<B>) {
+            if (a.col_stride == 1 and b.row_stride == 1 and b.col_stride != 1) {
+                for (std::size_t i = 0; i < m; i++) {
+                    for (std::size_t j = 0; j < n; j++) {
+                        T sum{};
+                        for (std::size_t p = 0; p < k; p++) {
+                            sum += a(i, p) * b(p, j);
+                        }
+                        c[i * ldc + j] += sum;
+                    }
+                }
+                return;
+            }
+        }
+        for (std::size_t i = 0; i < m; i++) {
+            for (std::size_t p = 0; p < k; p++) {
+                const T a_ip = a(i, p);
+                for (std::size_t j = 0; j < n; j++) {
+                    c[i * ldc + j] += a_ip * b(p, j);
+                }
+            }
+        }
+    }
+
+    // copies an mc * kc block of A into micro-panels of GEMM_MR rows, each
+    // stored column-by-column, zero-padding the ragged final panel
+    template <typename T, typename A>
+    void gemm_pack_a(
+        std::size_t mc, std::size_t kc,
+        const A& a, std::size_t row, std::size_t col,
+        T* packed
+    ) {
+        for (std::size_t i = 0; i < mc; i += GEMM_MR) {
+            const std::size_t mr = std::min(GEMM_MR, mc - i);
+            for (std::size_t p = 0; p < kc; p++) {
+                for (std::size_t r = 0; r < mr; r++) {
+                    packed[r] = a(row + i + r, col + p);
+                }
+                for (std::size_t r = mr; r < GEMM_MR; r++) {
+                    packed[r] = T{};
+                }
+                packed += GEMM_MR;
+            }
+        }
+    }
+
+    // copies a kc * nc block of B into micro-panels of GEMM_NR cols, each
+    // stored row-by-row, zero-padding the ragged final panel
+    template <typename T, typename B>
+    void gemm_pack_b(
+        std::size_t kc, std::size_t nc,
+        const B& b, std::size_t row, std::size_t col,
+        T* packed
+    ) {
+        for (std::size_t j = 0; j < nc; j += GEMM_NR) {
+            const std::size_t nr = std::min(GEMM_NR, nc - j);
+            for (std::size_t p = 0; p < kc; p++) {
+                for (std::size_t r = 0; r < nr; r++) {
+                    packed[r] = b(row + p, col + j + r);
+                }
+                for (std::size_t r = nr; r < GEMM_NR; r++) {
+                    packed[r] = T{};
+                }
+                packed += GEMM_NR;
+            }
+        }
+    }
+
+    // computes a GEMM_MR * GEMM_NR tile of C += A * B from packed panels
+    // the accumulators are a fixed-size local array so that the compiler
+    // keeps them in (vector) registers for the whole kc loop
+    template <typename T>
+    void gemm_micro_kernel(
+        std::size_t kc,
+        const T* a, const T* b,
+        T* c, std::size_t ldc,
+        std::size_t mr, std::size_t nr
+    ) {
+        T acc[GEMM_MR][GEMM_NR] = {};
+        for (std::size_t p = 0; p < kc; p++) {
+            for (std::size_t i = 0; i < GEMM_MR; i++) {
+                const T a_ip = a[i];
+                for (std::size_t j = 0; j < GEMM_NR; j++) {
+                    acc[i][j] += a_ip * b[j];
+                }
+            }
+            a += GEMM_MR;
+            b += GEMM_NR;
+        }
+        // only write back the part of the tile which is inside C
+        for (std::size_t i = 0; i < mr; i++) {
+            for (std::size_t j = 0; j < nr; j++) {
+                c[i * ldc + j] += acc[i][j];
+            }
+        }
+    }
+
+    // multiplies packed mc * kc block of A with packed kc * nc block of B
+    template <typename T>
+    void gemm_macro_kernel(
+        std::size_t mc, std::size_t nc, std::size_t kc,
+        const T* packed_a, const T* packed_b,
+        T* c, std::size_t ldc
+    ) {
+        for (std::size_t j = 0; j < nc; j += GEMM_NR) {
+            const std::size_t nr = std::min(GEMM_NR, nc - j);
+            for (std::size_t i = 0; i < mc; i += GEMM_MR) {
+                const std::size_t mr = std::min(GEMM_MR, mc - i);
+                gemm_micro_kernel(
+                    kc,
+                    packed_a + i * kc,
+                    packed_b + j * kc,
+                    c + i * ldc + j, ldc,
+                    mr, nr
+                );
+            }
+        }
+    }
+
+    // rounds x up to the next multiple of step
+    constexpr std::size_t gemm_round_up(std::size_t x, std::size_t step) {
+        return (x + step - 1) / step * step;
+    }
+
+    // size of the buffer gemm_slice() packs blocks of A into, for a product
+    // with m rows and a shared dimension of k
+    constexpr std::size_t gemm_packed_a_size(std::size_t m, std::size_t k) {
+        return gemm_round_up(std::min(m, GEMM_MC), GEMM_MR) * std::min(k, GEMM_KC);
+    }
+
+    // C += A * B for a kc-deep slice of the shared dimension starting at
+    // column col of A, whose kc * nc block of B is already packed
+    // A is read from row row onwards, a block at a time into packed_a, which
+    // must hold gemm_packed_a_size(mc, kc) cells
+    template <typename T, typename A>
+    void gemm_slice(
+        std::size_t m, std::size_t nc, std::size_t kc,
+        const A& a, std::size_t row, std::size_t col,
+        const T* packed_b, T* packed_a,
+        T* c, std::size_t ldc
+    ) {
+        // loop 3: partition rows of C and A into L2-sized blocks
+        for (std::size_t ic = 0; ic < m; ic += GEMM_MC) {
+            const std::size_t mc = std::min(GEMM_MC, m - ic);
+            gemm_pack_a(mc, kc, a, row + ic, col, packed_a);
+            gemm_macro_kernel(mc, nc, kc, packed_a, packed_b, c + ic * ldc, ldc);
+        }
+    }
+
+    // C += A * B, cache-blocked
+    // C is the m * n block of cells of row-major storage with leading dimension
+    // ldc starting at c, A is m * k and B is k * n, both accessed through
+    // operator()(row, col) so that any cell layout can be multiplied
+    template <typename T, typename A, typename B>
+    void gemm_blocked(
+        std::size_t m, std::size_t n, std::size_t k,
+        const A& a, const B& b,
+        T* c, std::size_t ldc
+    ) {
+        std::vector<T> packed_a(gemm_packed_a_size(m, k));
+        std::vector<T> packed_b(gemm_round_up(std::min(n, GEMM_NC), GEMM_NR) * std::min(k, GEMM_KC));
+        // loop 5: partition columns of C and B into L3-sized slabs
+        for (std::size_t jc = 0; jc < n; jc += GEMM_NC) {
+            const std::size_t nc = std::min(GEMM_NC, n - jc);
+            // loop 4: partition the shared dimension into L1-sized slices
+            for (std::size_t pc = 0; pc < k; pc += GEMM_KC) {
+                const std::size_t kc = std::min(GEMM_KC, k - pc);
+                gemm_pack_b(kc, nc, b, pc, jc, packed_b.data());
+                gemm_slice(m, nc, kc, a, 0, pc, packed_b.data(), packed_a.data(), c + jc, ldc);
+            }
+        }
+    }
+
+    // C += A * B, picking the best strategy for the size of the problem
+    // usable in constant expressions, where it falls back to the simple loop
+    template <typename T, typename A, typename B>
+    constexpr void gemm(
+        std::size_t m, std::size_t n, std::size_t k,
+        const A& a, const B& b,
+        T* c, std::size_t ldc
+    ) {
+        if (std::is_constant_evaluated() or m * n * k < GEMM_SMALL_SIZE) {
+            gemm_simple(m, n, k, a, b, c, ldc);
+        } else {
+            gemm_blocked(m, n, k, a, b, c, ldc);
+        }
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
@@ -0,0 +1,151 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_LU_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_LU_HPP
+
+#include <utility>
+
+#include <cstddef>
+
+// LU factorisation kernels shared by all Matrix types
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    // constexpr-friendly absolute value (std::abs isn't constexpr until C++23)
+    template <typename T>
+    constexpr T absolute(const T& x) {
+        return x < T{} ? -x : x;
+    }
+
+    // in-place LU factorisation with partial pivoting of the n * n row-major
+    // cells starting at a, so that P * A = L * U, with the unit-diagonal L
+    // stored below the diagonal and U on and above it
+    // if pivots is not null, pivots[k] receives the row swapped with row k
+    // returns the parity of the row permutation P (+1 or -1)
+    // a singular matrix is factorised as far as possible, leaving zeroes on
+    // the diagonal of U
+    template <typename T>
+    constexpr int lu_factorise(T* a, std::size_t n, std::size_t* pivots) {
+        int parity = 1;
+        for (std::size_t k = 0; k < n; k++) {
+            // find the row with the largest magnitude in column k
+            std::size_t pivot = k;
+            T largest = absolute(a[k * n + k]);
+            for (std::size_t i = k + 1; i < n; i++) {
+                T candidate = absolute(a[i * n + k]);
+                if (largest < candidate) {
+                    pivot = i;
+                    largest = candidate;
+                }
+            }
+            if (pivots != nullptr) {
+                pivots[k] = pivot;
+            }
+            // column is all zero, nothing to eliminate
+            if (largest == T{}) {
+                continue;
+            }
+            if (pivot != k) {
+                for (std::size_t j = 0; j < n; j++) {
+                    std::swap(a[k * n + j], a[pivot * n + j]);
+                }
+                parity = -parity;
+            }
+            // eliminate column k from all rows below, row-wise so that the
+            // inner loop is unit-stride
+            const T diagonal = a[k * n + k];
+            for (std::size_t i = k + 1; i < n; i++) {
+                T factor = a[i * n + k] / diagonal;
+                a[i * n + k] = factor;
+                for (std::size_t j = k + 1; j < n; j++) {
+                    a[i * n + j] -= factor * a[k * n + j];
+                }
+            }
+        }
+        return parity;
+    }
+
+    // determinant of the n * n row-major cells starting at a, destroying them
+    template <typename T>
+    constexpr T lu_determinant(T* a, std::size_t n) {
+        T product = lu_factorise(a, n, nullptr) < 0 ? T{-1} : T{1};
+        for (std::size_t k = 0; k < n; k++) {
+            product *= a[k * n + k];
+        }
+        return product;
+    }
+
+    // applies the row swaps of a factorisation from lu_factorise() to the
+    // n * columns row-major cells of B
+    template <typename T>
+    constexpr void lu_permute(std::size_t n, const std::size_t* pivots, T* b, std::size_t columns) {
+        for (std::size_t k = 0; k < n; k++) {
+            if (pivots[k] != k) {
+                for (std::size_t c = 0; c < columns; c++) {
+                    std::swap(b[k * columns + c], b[pivots[k] * columns + c]);
+                }
+            }
+        }
+    }
+
+    // solves L * U * X = B in place for the columns [begin, end) of the n rows
+    // of B, which are stride cells apart, given the factors of a non-singular
+    // A from lu_factorise() and B with its rows already permuted
+    // columns are independent of each other, so ranges of them may be solved
+    // for concurrently
+    template <typename T>
+    constexpr void lu_substitute(
+        const T* lu, std::size_t n,
+        T* b, std::size_t stride, std::size_t begin, std::size_t end
+    ) {
+        // forward substitution with the unit lower triangle L
+        for (std::size_t i = 0; i < n; i++) {
+            for (std::size_t k = 0; k < i; k++) {
+                const T factor = lu[i * n + k];
+                for (std::size_t c = begin; c < end; c++) {
+                    b[i * stride + c] -= factor * b[k * stride + c];
+                }
+            }
+        }
+        // back substitution with the upper triangle U
+        for (std::size_t i = n; i-- > 0;) {
+            for (std::size_t k = i + 1; k < n; k++) {
+                const T factor = lu[i * n + k];
+                for (std::size_t c = begin; c < end; c++) {
+                    b[i * stride + c] -= factor * b[k * stride + c];
+                }
+            }
+            const T diagonal = lu[i * n + i];
+            for (std::size_t c = begin; c < end; c++) {
+                b[i * stride + c] /= diagonal;
+            }
+        }
+    }
+
+    // solves A * X = B in place of the n * columns row-major cells of B, given
+    // the factors and pivots of a non-singular A from lu_factorise()
+    template <typename T>
+    constexpr void lu_solve(const T* lu, std::size_t n, const std::size_t* pivots, T* b, std::size_t columns) {
+        lu_permute(n, pivots, b, columns);
+        lu_substitute(lu, n, b, columns, 0, columns);
+    }
+
+    // inverse of the n * n row-major cells starting at a, destroying them,
+    // into the n * n cells at out, pivots needs room for n row indices
+    // returns false (leaving out unspecified) if the cells are singular
+    template <typename T>
+    constexpr bool lu_inverse(T* a, std::size_t n, std::size_t* pivots, T* out) {
+        lu_factorise(a, n, pivots);
+        for (std::size_t k = 0; k < n; k++) {
+            if (a[k * n + k] == T{}) {
+                return false;
+            }
+        }
+        // solve for the columns of the identity
+        for (std::size_t i = 0; i < n; i++) {
+            for (std::size_t j = 0; j < n; j++) {
+                out[i * n + j] = i == j ? T{1} : T{};
+            }
+        }
+        lu_solve(a, n, pivots, out, n);
+        return true;
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
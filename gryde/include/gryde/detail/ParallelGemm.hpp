@@ -0,0 +1,83 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_PARALLEL_GEMM_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_PARALLEL_GEMM_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <cstddef>
+
+#include <gryde/ThreadPool.hpp>
+#include <gryde/detail/Gemm.hpp>
+
+// multi-threaded matrix-matrix multiplication, on top of the serial engine
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    // problems with fewer multiply-adds than this aren't worth spreading across threads
+    inline constexpr std::size_t GEMM_PARALLEL_MIN_SIZE = 96 * 96 * 96;
+    // largest tile of C computed by one task, tiles are made shorter until
+    // there are enough of them to go around the pool
+    inline constexpr std::size_t GEMM_TILE_ROWS = GEMM_MC;
+    inline constexpr std::size_t GEMM_TILE_COLS = 256;
+    // tiles to aim for per thread, so stealing can balance uneven progress
+    inline constexpr std::size_t GEMM_TILES_PER_THREAD = 4;
+
+    // C += A * B like gemm(), with tiles of C computed in parallel on pool
+    template <typename T, typename A, typename B>
+    void parallel_gemm(
+        ThreadPool& pool,
+        std::size_t m, std::size_t n, std::size_t k,
+        const A& a, const B& b,
+        T* c, std::size_t ldc
+    ) {
+        const std::size_t threads = pool.worker_count() + 1;
+        if (threads == 1 or m * n * k < GEMM_PARALLEL_MIN_SIZE) {
+            return gemm(m, n, k, a, b, c, ldc);
+        }
+        const std::size_t tile_cols = std::min(GEMM_TILE_COLS, gemm_round_up(n, GEMM_NR));
+        const std::size_t cols = (n + tile_cols - 1) / tile_cols;
+        std::size_t tile_rows = GEMM_TILE_ROWS;
+        while (
+            ((m + tile_rows - 1) / tile_rows) * cols < threads * GEMM_TILES_PER_THREAD and
+            tile_rows > GEMM_MR * 4
+        ) {
+            tile_rows /= 2;
+        }
+        const std::size_t rows = (m + tile_rows - 1) / tile_rows;
+        const std::size_t slices = (k + GEMM_KC - 1) / GEMM_KC;
+        // B is packed once up front rather than by every row of tiles, the
+        // panels for column of tiles j take up k * panel cells from
+        // j * k * panel on, a kc-deep slice after another
+        const std::size_t panel = gemm_round_up(tile_cols, GEMM_NR);
+        std::vector<T> packed_b(cols * k * panel);
+        pool.parallel_for(cols * slices, [&](std::size_t s) {
+            const std::size_t j = s / slices;
+            const std::size_t pc = s % slices * GEMM_KC;
+            gemm_pack_b(
+                std::min(GEMM_KC, k - pc), std::min(tile_cols, n - j * tile_cols),
+                b, pc, j * tile_cols,
+                packed_b.data() + (j * k + pc) * panel
+            );
+        });
+        // tiles of C don't overlap, so tasks don't need to synchronise
+        pool.parallel_for(rows * cols, [&](std::size_t tile) {
+            const std::size_t i = tile / cols * tile_rows;
+            const std::size_t j = tile % cols;
+            const std::size_t mc = std::min(tile_rows, m - i);
+            // each thread keeps the buffer it packs blocks of A into from one
+            // tile to the next
+            thread_local std::vector<T> packed_a;
+            if (packed_a.size() < gemm_packed_a_size(mc, k)) {
+                packed_a.resize(gemm_packed_a_size(mc, k));
+            }
+            for (std::size_t pc = 0; pc < k; pc += GEMM_KC) {
+                gemm_slice(
+                    mc, std::min(tile_cols, n - j * tile_cols), std::min(GEMM_KC, k - pc),
+                    a, i, pc,
+                    packed_b.data() + (j * k + pc) * panel, packed_a.data(),
+                    c + i * ldc + j * tile_cols, ldc
+                );
+            }
+        });
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
@@ -0,0 +1,249 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_SIMD_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_SIMD_HPP
+
+#include <type_traits>
+
+#include <cstddef>
+#include <cstring>
+
+// vectorised kernels for element-wise operations on contiguous cells, with
+// the instruction set picked at run-time so one binary runs well everywhere
+// NOTE: this is an implementation detail, not part of the public API
+//
+// the kernels are written once with GCC/Clang vector extensions and compiled
+// for each x86 instruction set with target attributes, other compilers and
+// architectures get a plain loop for the compiler to auto-vectorise
+#if (defined(__GNUC__) or defined(__clang__)) and (defined(__x86_64__) or defined(__i386__))
+#define GRYDE_SIMD_DISPATCH 1
+#else
+#define GRYDE_SIMD_DISPATCH 0
+#endif
+
+#if defined(__GNUC__) or defined(__clang__)
+#define GRYDE_ALWAYS_INLINE [[gnu::always_inline]]
+#else
+#define GRYDE_ALWAYS_INLINE
+#endif
+
+namespace com::saxbophone::gryde::detail::simd {
+    // instruction sets, in order of increasing vector width
+    enum class Isa {
+        SCALAR,
+        SSE2,
+        AVX2,
+        AVX512,
+    };
+
+    // element-wise operations that the kernels implement
+    enum class Operation {
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        SCALE,
+    };
+
+    // element types the kernels are instantiated for
+    template <typename T>
+    inline constexpr bool is_vectorisable_v =
+        std::is_same_v<T, float> or std::is_same_v<T, double> or (
+            std::is_integral_v<T> and not std::is_same_v<T, bool> and
+            (sizeof(T) == 4 or sizeof(T) == 8)
+        );
+
+    // widest instruction set supported by the CPU we're running on
+    inline Isa detect_isa() {
+#if GRYDE_SIMD_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return Isa::AVX512;
+        } else if (__builtin_cpu_supports("avx2")) {
+            return Isa::AVX2;
+        } else if (__builtin_cpu_supports("sse2")) {
+            return Isa::SSE2;
+        }
+#endif
+        return Isa::SCALAR;
+    }
+
+    // detected once, on first use
+    inline Isa active_isa() {
+        static const Isa isa = detect_isa();
+        return isa;
+    }
+
+    // applies OP to one cell or one vector of cells, through references so
+    // that vectors are never passed by value between differently-targeted code
+    template <Operation OP, typename V>
+    GRYDE_ALWAYS_INLINE inline void apply(V& result, const V& a, const V& b, const V& scalar) {
+        if constexpr (OP == Operation::ADD) {
+            result = a + b;
+        } else if constexpr (OP == Operation::SUBTRACT) {
+            result = a - b;
+        } else if constexpr (OP == Operation::MULTIPLY) {
+            result = a * b;
+        } else {
+            result = a * scalar;
+        }
+    }
+
+    // applies OP to cell i, b is never read for SCALE, so it may be null
+    template <Operation OP, typename T>
+    GRYDE_ALWAYS_INLINE inline void apply_cell(T& result, const T* a, const T* b, std::size_t i, T scalar) {
+        if constexpr (OP == Operation::SCALE) {
+            apply<OP>(result, a[i], a[i], scalar);
+        } else {
+            apply<OP>(result, a[i], b[i], scalar);
+        }
+    }
+
+    // out[i] = a[i] OP b[i] (or a[i] * scalar), for count cells
+    template <Operation OP, typename T>
+    inline void transform_scalar(const T* a, const T* b, T scalar, T* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; i++) {
+            apply_cell<OP>(out[i], a, b, i, scalar);
+        }
+    }
+
+    // a[i] == b[i] for all count cells
+    template <typename T>
+    inline bool equal_scalar(const T* a, const T* b, std::size_t count) {
+        for (std::size_t i = 0; i < count; i++) {
+            if (not (a[i] == b[i])) { return false; }
+        }
+        return true;
+    }
+
+#if GRYDE_SIMD_DISPATCH
+    // number of vectors compared between checks for early exit
+    inline constexpr std::size_t EQUAL_BLOCK_VECTORS = 16;
+
+    // the body of the transform kernel for vectors of WIDTH bytes, inlined
+    // into a wrapper per instruction set which sets the code generation target
+    template <std::size_t WIDTH, Operation OP, typename T>
+    GRYDE_ALWAYS_INLINE inline void transform_lanes(const T* a, const T* b, T scalar, T* out, std::size_t count) {
+        typedef T vector_t [[gnu::vector_size(WIDTH)]];
+        constexpr std::size_t LANES = WIDTH / sizeof(T);
+        const vector_t scalars = vector_t{} + scalar;
+        // cells in whole vectors, counted up front so that the compiler can
+        // see the loops below don't overflow
+        const std::size_t whole = count - count % LANES;
+        std::size_t i = 0;
+        for (; i < whole; i += LANES) {
+            vector_t x, y = {}, result;
+            std::memcpy(&x, a + i, WIDTH);
+            if constexpr (OP != Operation::SCALE) {
+                std::memcpy(&y, b + i, WIDTH);
+            }
+            apply<OP>(result, x, y, scalars);
+            std::memcpy(out + i, &result, WIDTH);
+        }
+        // ragged end which doesn't fill a vector
+        for (; i < count; i++) {
+            apply_cell<OP>(out[i], a, b, i, scalar);
+        }
+    }
+
+    template <std::size_t WIDTH, typename T>
+    GRYDE_ALWAYS_INLINE inline bool equal_lanes(const T* a, const T* b, std::size_t count) {
+        typedef T vector_t [[gnu::vector_size(WIDTH)]];
+        using mask_t = decltype(vector_t{} != vector_t{});
+        constexpr std::size_t LANES = WIDTH / sizeof(T);
+        constexpr std::size_t BLOCK = LANES * EQUAL_BLOCK_VECTORS;
+        std::size_t i = 0;
+        for (; i + BLOCK <= count; i += BLOCK) {
+            // accumulate differences over a block, then check them all at once
+            mask_t differences = {};
+            for (std::size_t j = i; j < i + BLOCK; j += LANES) {
+                vector_t x, y;
+                std::memcpy(&x, a + j, WIDTH);
+                std::memcpy(&y, b + j, WIDTH);
+                differences |= x != y;
+            }
+            for (std::size_t lane = 0; lane < LANES; lane++) {
+                if (differences[lane] != 0) { return false; }
+            }
+        }
+        return equal_scalar(a + i, b + i, count - i);
+    }
+
+    template <Operation OP, typename T>
+    [[gnu::target("sse2")]] inline void transform_sse2(const T* a, const T* b, T scalar, T* out, std::size_t count) {
+        transform_lanes<16, OP>(a, b, scalar, out, count);
+    }
+
+    template <Operation OP, typename T>
+    [[gnu::target("avx2")]] inline void transform_avx2(const T* a, const T* b, T scalar, T* out, std::size_t count) {
+        transform_lanes<32, OP>(a, b, scalar, out, count);
+    }
+
+    template <Operation OP, typename T>
+    [[gnu::target("avx512f")]] inline void transform_avx512(const T* a, const T* b, T scalar, T* out, std::size_t count) {
+        transform_lanes<64, OP>(a, b, scalar, out, count);
+    }
+
+    template <typename T>
+    [[gnu::target("sse2")]] inline bool equal_sse2(const T* a, const T* b, std::size_t count) {
+        return equal_lanes<16>(a, b, count);
+    }
+
+    template <typename T>
+    [[gnu::target("avx2")]] inline bool equal_avx2(const T* a, const T* b, std::size_t count) {
+        return equal_lanes<32>(a, b, count);
+    }
+
+    template <typename T>
+    [[gnu::target("avx512f")]] inline bool equal_avx512(const T* a, const T* b, std::size_t count) {
+        return equal_lanes<64>(a, b, count);
+    }
+#endif
+
+    // out[i] = a[i] OP b[i] for count cells, using the given instruction set
+    // for SCALE, b is unused and may be null
+    template <Operation OP, typename T>
+    void transform(Isa isa, const T* a, const T* b, T scalar, T* out, std::size_t count) {
+#if GRYDE_SIMD_DISPATCH
+        switch (isa) {
+        case Isa::AVX512:
+            return transform_avx512<OP>(a, b, scalar, out, count);
+        case Isa::AVX2:
+            return transform_avx2<OP>(a, b, scalar, out, count);
+        case Isa::SSE2:
+            return transform_sse2<OP>(a, b, scalar, out, count);
+        case Isa::SCALAR:
+            break;
+        }
+#endif
+        transform_scalar<OP>(a, b, scalar, out, count);
+    }
+
+    // out[i] = a[i] OP b[i] for count cells, using the widest instruction set
+    template <Operation OP, typename T>
+    void transform(const T* a, const T* b, T scalar, T* out, std::size_t count) {
+        transform<OP>(active_isa(), a, b, scalar, out, count);
+    }
+
+    // whether a[i] == b[i] for all count cells, using the given instruction set
+    template <typename T>
+    bool equal(Isa isa, const T* a, const T* b, std::size_t count) {
+#if GRYDE_SIMD_DISPATCH
+        switch (isa) {
+        case Isa::AVX512:
+            return equal_avx512(a, b, count);
+        case Isa::AVX2:
+            return equal_avx2(a, b, count);
+        case Isa::SSE2:
+            return equal_sse2(a, b, count);
+        case Isa::SCALAR:
+            break;
+        }
+#endif
+        return equal_scalar(a, b, count);
+    }
+
+    // whether a[i] == b[i] for all count cells, using the widest instruction set
+    template <typename T>
+    bool equal(const T* a, const T* b, std::size_t count) {
+        return equal(active_isa(), a, b, count);
+    }
+} // namespace com::saxbophone::gryde::detail::simd
+#endif // include guard
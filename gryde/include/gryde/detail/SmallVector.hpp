@@ -0,0 +1,134 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_SMALL_VECTOR_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <gryde/AlignedAllocator.hpp>
+
+// storage for the cells of dynamic-size Matrix
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    // contiguous storage for a number of elements fixed at construction, which
+    // are kept inline when there are at most CAPACITY of them and are only
+    // allocated (with Allocator) when there are more
+    // only the inline elements in use are ever copied, and the inline buffer
+    // starts on a cache line boundary, like allocated storage
+    // all CAPACITY inline elements are default-initialised, which only costs
+    // nothing for trivial types
+    template <typename T, std::size_t CAPACITY, typename Allocator = std::allocator<T>>
+    class SmallVector {
+    public:
+        using value_type = T;
+        explicit SmallVector(const Allocator& allocator = Allocator())
+          : _heap(allocator)
+          , _size(0)
+          {}
+        // value-initialises size elements
+        SmallVector(std::size_t size, const Allocator& allocator = Allocator())
+          : _heap(allocator)
+          , _size(size)
+          {
+            if (size > CAPACITY) {
+                _heap.resize(size);
+            } else {
+                std::fill_n(_inline.begin(), size, T{});
+            }
+        }
+        SmallVector(const SmallVector& other)
+          : _heap(other._heap)
+          , _size(other._size)
+          {
+            _copy_inline(other);
+        }
+        SmallVector& operator=(const SmallVector& other) {
+            if (this != &other) {
+                // copy the allocated elements first, so nothing changes if that throws
+                _heap = other._heap;
+                _size = other._size;
+                _copy_inline(other);
+            }
+            return *this;
+        }
+        // moved-from vectors are left empty, whether their elements were inline or not
+        SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+          : _heap(std::move(other._heap))
+          , _size(std::exchange(other._size, 0))
+          {
+            _move_inline(other);
+        }
+        // moving allocated elements between unequal allocators which don't
+        // propagate (such as polymorphic_allocator) allocates, so may throw
+        SmallVector& operator=(SmallVector&& other) noexcept(
+            std::is_nothrow_move_assignable_v<T> and (
+                std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value or
+                std::allocator_traits<Allocator>::is_always_equal::value
+            )
+        ) {
+            if (this != &other) {
+                // take the allocated elements first, so nothing changes if that throws
+                _heap = std::move(other._heap);
+                _size = std::exchange(other._size, 0);
+                other._release();
+                _move_inline(other);
+            }
+            return *this;
+        }
+        // replaces the elements with copies of cells
+        void assign(std::span<const T> cells) {
+            if (cells.size() > CAPACITY) {
+                _heap.assign(cells.begin(), cells.end());
+                _size = cells.size();
+            } else {
+                _size = cells.size();
+                _release();
+                std::copy(cells.begin(), cells.end(), _inline.begin());
+            }
+        }
+        // whether the elements are stored inline, without any allocation
+        bool is_inline() const { return _size <= CAPACITY; }
+        T* data() { return is_inline() ? _inline.data() : _heap.data(); }
+        const T* data() const { return is_inline() ? _inline.data() : _heap.data(); }
+        std::size_t size() const { return _size; }
+        T* begin() { return data(); }
+        T* end() { return data() + _size; }
+        const T* begin() const { return data(); }
+        const T* end() const { return data() + _size; }
+        T& operator[](std::size_t i) { return data()[i]; }
+        const T& operator[](std::size_t i) const { return data()[i]; }
+        Allocator get_allocator() const { return _heap.get_allocator(); }
+    private:
+        // frees any allocated storage, which is never kept while the elements
+        // are inline
+        void _release() noexcept {
+            std::vector<T, Allocator>(_heap.get_allocator()).swap(_heap);
+        }
+        // takes the inline elements in use from other, once _size is set
+        void _copy_inline(const SmallVector& other) {
+            if (is_inline()) {
+                _release();
+                std::copy_n(other._inline.begin(), _size, _inline.begin());
+            }
+        }
+        void _move_inline(SmallVector& other) {
+            if (is_inline()) {
+                _release();
+                std::move(other._inline.begin(), other._inline.begin() + _size, _inline.begin());
+            }
+        }
+
+        // default-initialised, so that cells of trivial types cost nothing
+        // until they're used
+        alignas(CACHE_LINE_SIZE) alignas(T) std::array<T, CAPACITY> _inline;
+        std::vector<T, Allocator> _heap;
+        std::size_t _size;
+    };
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
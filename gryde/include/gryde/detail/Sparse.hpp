@@ -0,0 +1,397 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_SPARSE_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_SPARSE_HPP
+
+#include <algorithm>
+#include <compare>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <gryde/ThreadPool.hpp>
+
+// kernels on compressed sparse arrays, shared by the row and column formats
+// NOTE: this is an implementation detail, not part of the public API
+//
+// the arrays hold major lines of minor cells: rows of columns for compressed
+// sparse row (CSR), columns of rows for compressed sparse column (CSC), so
+// that every kernel serves both formats, with major and minor swapped
+namespace com::saxbophone::gryde::detail {
+    // fewest major lines given to each task, so tasks are worth sharing out
+    inline constexpr std::size_t SPARSE_CHUNK_SIZE = 1024;
+    // most tasks per thread of a pool, enough to balance lines of uneven
+    // length, while bounding the scratch space that each task needs
+    inline constexpr std::size_t SPARSE_TASKS_PER_THREAD = 4;
+    // fewest columns of a dense right-hand side given to each task
+    inline constexpr std::size_t SPARSE_COLUMNS_PER_TASK = 64;
+
+    // compressed sparse arrays, the cells of major line i are at positions
+    // [offsets[i], offsets[i + 1]) of indices (their minor indices, ascending)
+    // and values
+    template <typename T>
+    struct CompressedCells {
+        std::vector<std::size_t> offsets;
+        std::vector<std::size_t> indices;
+        std::vector<T> values;
+
+        bool operator==(const CompressedCells&) const = default;
+    };
+
+    // calls body(begin, end) for consecutive ranges covering [0, count), in
+    // parallel on pool if it's not null and there are at least two ranges of
+    // grain or more to share
+    template <typename Body>
+    void sparse_for(ThreadPool* pool, std::size_t count, std::size_t grain, const Body& body) {
+        std::size_t tasks = count / grain;
+        if (pool != nullptr) {
+            tasks = std::min(tasks, SPARSE_TASKS_PER_THREAD * (pool->worker_count() + 1));
+        }
+        if (pool == nullptr or tasks < 2) {
+            body(std::size_t{0}, count);
+            return;
+        }
+        pool->parallel_for(tasks, [&](std::size_t task) {
+            body(count * task / tasks, count * (task + 1) / tasks);
+        });
+    }
+
+    // compresses the (major, minor, value) triples of a matrix with major
+    // lines into sorted lines, summing the values of any duplicates
+    template <typename T>
+    CompressedCells<T> sparse_compress(
+        std::size_t major, std::span<const std::size_t> majors,
+        std::span<const std::size_t> minors, std::span<const T> values
+    ) {
+        // counting sort by major line
+        std::vector<std::size_t> offsets(major + 1);
+        for (std::size_t i : majors) {
+            offsets[i + 1]++;
+        }
+        for (std::size_t i = 0; i < major; i++) {
+            offsets[i + 1] += offsets[i];
+        }
+        std::vector<std::pair<std::size_t, T>> placed(values.size());
+        std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+        for (std::size_t c = 0; c < values.size(); c++) {
+            placed[next[majors[c]]++] = {minors[c], values[c]};
+        }
+        // then sort each line by minor index and merge duplicates
+        CompressedCells<T> cells;
+        cells.offsets.resize(major + 1);
+        cells.indices.reserve(values.size());
+        cells.values.reserve(values.size());
+        for (std::size_t i = 0; i < major; i++) {
+            auto begin = placed.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+            auto end = placed.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+            std::stable_sort(begin, end, [](const auto& a, const auto& b) { return a.first < b.first; });
+            for (auto it = begin; it != end; ++it) {
+                if (cells.indices.size() > cells.offsets[i] and cells.indices.back() == it->first) {
+                    cells.values.back() += it->second;
+                } else {
+                    cells.indices.push_back(it->first);
+                    cells.values.push_back(it->second);
+                }
+            }
+            cells.offsets[i + 1] = cells.indices.size();
+        }
+        return cells;
+    }
+
+    // sorts each major line of cells by minor index and merges duplicates, in
+    // parallel on pool if it's not null, then closes up the gaps left behind
+    // duplicates are summed in order of value, so that the sums don't depend on
+    // the order which the cells of a line were placed in
+    template <typename T>
+    void sparse_merge_lines(CompressedCells<T>& cells, ThreadPool* pool) {
+        const std::size_t major = cells.offsets.size() - 1;
+        std::vector<std::size_t> lengths(major);
+        sparse_for(pool, major, SPARSE_CHUNK_SIZE, [&](std::size_t begin, std::size_t end) {
+            std::vector<std::pair<std::size_t, T>> line;
+            for (std::size_t i = begin; i < end; i++) {
+                const std::size_t first = cells.offsets[i];
+                line.clear();
+                for (std::size_t c = first; c < cells.offsets[i + 1]; c++) {
+                    line.emplace_back(cells.indices[c], cells.values[c]);
+                }
+                std::sort(line.begin(), line.end(), [](const auto& a, const auto& b) {
+                    return a.first != b.first ? a.first < b.first : std::is_lt(std::strong_order(a.second, b.second));
+                });
+                std::size_t length = 0;
+                for (const auto& [index, value] : line) {
+                    if (length > 0 and cells.indices[first + length - 1] == index) {
+                        cells.values[first + length - 1] += value;
+                    } else {
+                        cells.indices[first + length] = index;
+                        cells.values[first + length] = value;
+                        length++;
+                    }
+                }
+                lengths[i] = length;
+            }
+        });
+        // each line only moves towards the front, so they're moved in order
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < major; i++) {
+            const std::size_t first = std::exchange(cells.offsets[i], size);
+            if (first != size) {
+                std::copy(
+                    cells.indices.data() + first, cells.indices.data() + first + lengths[i],
+                    cells.indices.data() + size
+                );
+                std::copy(
+                    cells.values.data() + first, cells.values.data() + first + lengths[i],
+                    cells.values.data() + size
+                );
+            }
+            size += lengths[i];
+        }
+        if (size != cells.offsets[major]) {
+            cells.offsets[major] = size;
+            cells.indices.resize(size);
+            cells.values.resize(size);
+            cells.indices.shrink_to_fit();
+            cells.values.shrink_to_fit();
+        }
+    }
+
+    // the same matrix with major and minor swapped, by counting sort, which
+    // both transposes a matrix and converts it between CSR and CSC
+    template <typename T>
+    CompressedCells<T> sparse_transpose(const CompressedCells<T>& a, std::size_t minor) {
+        const std::size_t major = a.offsets.size() - 1;
+        CompressedCells<T> t;
+        t.offsets.assign(minor + 1, 0);
+        t.indices.resize(a.indices.size());
+        t.values.resize(a.values.size());
+        for (std::size_t j : a.indices) {
+            t.offsets[j + 1]++;
+        }
+        for (std::size_t j = 0; j < minor; j++) {
+            t.offsets[j + 1] += t.offsets[j];
+        }
+        // visiting the major lines in order leaves the new lines sorted
+        std::vector<std::size_t> next(t.offsets.begin(), t.offsets.end() - 1);
+        for (std::size_t i = 0; i < major; i++) {
+            for (std::size_t c = a.offsets[i]; c < a.offsets[i + 1]; c++) {
+                std::size_t position = next[a.indices[c]]++;
+                t.indices[position] = i;
+                t.values[position] = a.values[c];
+            }
+        }
+        return t;
+    }
+
+    // out = A * B, for the major * minor A and the minor * columns row-major
+    // cells of a dense B, where the major lines of A are rows of the product
+    // (the rows of CSR), each task computing whole rows of it
+    template <typename T>
+    void sparse_gather_multiply(
+        const CompressedCells<T>& a, const T* b, T* out, std::size_t columns, ThreadPool* pool
+    ) {
+        const std::size_t major = a.offsets.size() - 1;
+        sparse_for(pool, major, SPARSE_CHUNK_SIZE, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                T* row = out + i * columns;
+                for (std::size_t c = a.offsets[i]; c < a.offsets[i + 1]; c++) {
+                    const T value = a.values[c];
+                    const T* other = b + a.indices[c] * columns;
+                    for (std::size_t j = 0; j < columns; j++) {
+                        row[j] += value * other[j];
+                    }
+                }
+            }
+        });
+    }
+
+    // out = A * B, for the minor * major A and the major * columns row-major
+    // cells of a dense B, where the major lines of A are columns of it (the
+    // columns of CSC), so each line scatters into every row of the product
+    // wide products are split between tasks by columns of B, a single column
+    // by lines of A into partial products which are summed afterwards, with
+    // no more of them than fit in the space of A's cells
+    template <typename T>
+    void sparse_scatter_multiply(
+        const CompressedCells<T>& a, std::size_t minor,
+        const T* b, T* out, std::size_t columns, ThreadPool* pool
+    ) {
+        const std::size_t major = a.offsets.size() - 1;
+        auto scatter = [&](std::size_t begin, std::size_t end, std::size_t first, std::size_t last, T* into) {
+            for (std::size_t i = begin; i < end; i++) {
+                for (std::size_t c = a.offsets[i]; c < a.offsets[i + 1]; c++) {
+                    const T value = a.values[c];
+                    const T* other = b + i * columns;
+                    T* row = into + a.indices[c] * columns;
+                    for (std::size_t j = first; j < last; j++) {
+                        row[j] += value * other[j];
+                    }
+                }
+            }
+        };
+        if (columns >= 2 * SPARSE_COLUMNS_PER_TASK) {
+            sparse_for(pool, columns, SPARSE_COLUMNS_PER_TASK, [&](std::size_t first, std::size_t last) {
+                scatter(0, major, first, last, out);
+            });
+            return;
+        }
+        std::size_t parts = 1;
+        if (pool != nullptr and minor > 0 and columns > 0) {
+            parts = std::min({
+                pool->worker_count() + 1,
+                major / SPARSE_CHUNK_SIZE,
+                a.values.size() / (minor * columns),
+            });
+        }
+        if (parts < 2) {
+            scatter(0, major, 0, columns, out);
+            return;
+        }
+        // the first part goes straight into the output, the rest into scratch
+        std::vector<T> partials((parts - 1) * minor * columns);
+        pool->parallel_for(parts, [&](std::size_t part) {
+            T* into = part == 0 ? out : partials.data() + (part - 1) * minor * columns;
+            scatter(major * part / parts, major * (part + 1) / parts, 0, columns, into);
+        });
+        sparse_for(pool, minor * columns, SPARSE_CHUNK_SIZE, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t part = 1; part < parts; part++) {
+                const T* partial = partials.data() + (part - 1) * minor * columns;
+                for (std::size_t c = begin; c < end; c++) {
+                    out[c] += partial[c];
+                }
+            }
+        });
+    }
+
+    // builds compressed arrays with the given number of major lines, each
+    // task calling line(i, indices, values) to append the sorted cells of
+    // each line i of a range of them to its own arrays, which are joined
+    // together afterwards
+    // each task gets its own line from make_line(), so that lines may keep
+    // scratch space between calls
+    template <typename T, typename MakeLine>
+    CompressedCells<T> sparse_build(std::size_t major, ThreadPool* pool, const MakeLine& make_line) {
+        struct Part {
+            std::size_t begin;
+            std::vector<std::size_t> indices;
+            std::vector<T> values;
+        };
+        CompressedCells<T> cells;
+        cells.offsets.assign(major + 1, 0);
+        std::vector<Part> parts;
+        std::size_t tasks = 1;
+        if (pool != nullptr) {
+            tasks = std::min(major / SPARSE_CHUNK_SIZE, SPARSE_TASKS_PER_THREAD * (pool->worker_count() + 1));
+        }
+        tasks = std::max(tasks, std::size_t{1});
+        parts.resize(tasks);
+        auto build = [&](std::size_t task) {
+            Part& part = parts[task];
+            part.begin = major * task / tasks;
+            const std::size_t end = major * (task + 1) / tasks;
+            auto line = make_line();
+            for (std::size_t i = part.begin; i < end; i++) {
+                line(i, part.indices, part.values);
+                // line lengths for now, summed into offsets below
+                cells.offsets[i + 1] = part.indices.size();
+            }
+        };
+        if (tasks > 1) {
+            pool->parallel_for(tasks, build);
+        } else {
+            build(0);
+        }
+        // turn each part's running lengths into offsets into the whole
+        std::vector<std::size_t> starts(tasks + 1);
+        for (std::size_t task = 0; task < tasks; task++) {
+            starts[task + 1] = starts[task] + parts[task].indices.size();
+            const std::size_t end = task + 1 < tasks ? parts[task + 1].begin : major;
+            for (std::size_t i = parts[task].begin; i < end; i++) {
+                cells.offsets[i + 1] += starts[task];
+            }
+        }
+        cells.indices.resize(starts[tasks]);
+        cells.values.resize(starts[tasks]);
+        auto join = [&](std::size_t task) {
+            std::ranges::copy(parts[task].indices, cells.indices.begin() + static_cast<std::ptrdiff_t>(starts[task]));
+            std::ranges::copy(parts[task].values, cells.values.begin() + static_cast<std::ptrdiff_t>(starts[task]));
+        };
+        if (tasks > 1) {
+            pool->parallel_for(tasks, join);
+        } else {
+            join(0);
+        }
+        return cells;
+    }
+
+    // A + B or A - B, of matrices with the same major and minor extents, by
+    // merging their sorted lines
+    template <bool SUBTRACT, typename T>
+    CompressedCells<T> sparse_add(const CompressedCells<T>& a, const CompressedCells<T>& b, ThreadPool* pool) {
+        auto merge = [&](std::size_t i, std::vector<std::size_t>& indices, std::vector<T>& values) {
+            std::size_t x = a.offsets[i];
+            std::size_t y = b.offsets[i];
+            while (x < a.offsets[i + 1] or y < b.offsets[i + 1]) {
+                const std::size_t j = std::min(
+                    x < a.offsets[i + 1] ? a.indices[x] : std::numeric_limits<std::size_t>::max(),
+                    y < b.offsets[i + 1] ? b.indices[y] : std::numeric_limits<std::size_t>::max()
+                );
+                T sum{};
+                if (x < a.offsets[i + 1] and a.indices[x] == j) {
+                    sum = a.values[x++];
+                }
+                if (y < b.offsets[i + 1] and b.indices[y] == j) {
+                    if constexpr (SUBTRACT) {
+                        sum -= b.values[y++];
+                    } else {
+                        sum += b.values[y++];
+                    }
+                }
+                indices.push_back(j);
+                values.push_back(sum);
+            }
+        };
+        return sparse_build<T>(a.offsets.size() - 1, pool, [&] { return merge; });
+    }
+
+    // A * B, for an A with major lines of B's major extent and a B with the
+    // given minor extent, giving the major lines of the product as sums of
+    // B's lines (Gustavson's algorithm), so for CSR the product of A and B,
+    // and for CSC, with A and B swapped, of B and A
+    template <typename T>
+    CompressedCells<T> sparse_multiply(
+        const CompressedCells<T>& a, const CompressedCells<T>& b, std::size_t minor, ThreadPool* pool
+    ) {
+        // each task has a dense accumulator the size of a line of the
+        // product, reused for every line, with each cell marked by the last
+        // line to touch it
+        return sparse_build<T>(a.offsets.size() - 1, pool, [&] {
+            constexpr std::size_t UNSEEN = std::numeric_limits<std::size_t>::max();
+            return [&, sums = std::vector<T>(minor), marks = std::vector<std::size_t>(minor, UNSEEN), touched = std::vector<std::size_t>()](
+                std::size_t i, std::vector<std::size_t>& indices, std::vector<T>& values
+            ) mutable {
+                touched.clear();
+                for (std::size_t c = a.offsets[i]; c < a.offsets[i + 1]; c++) {
+                    const T value = a.values[c];
+                    const std::size_t k = a.indices[c];
+                    for (std::size_t d = b.offsets[k]; d < b.offsets[k + 1]; d++) {
+                        const std::size_t j = b.indices[d];
+                        if (marks[j] != i) {
+                            marks[j] = i;
+                            sums[j] = value * b.values[d];
+                            touched.push_back(j);
+                        } else {
+                            sums[j] += value * b.values[d];
+                        }
+                    }
+                }
+                std::ranges::sort(touched);
+                for (std::size_t j : touched) {
+                    indices.push_back(j);
+                    values.push_back(sums[j]);
+                }
+            };
+        });
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
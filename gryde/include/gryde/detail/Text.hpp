@@ -0,0 +1,213 @@
+#ifndef COM_SAXBOPHONE_GRYDE_DETAIL_TEXT_HPP
+#define COM_SAXBOPHONE_GRYDE_DETAIL_TEXT_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <gryde/ThreadPool.hpp>
+
+// parsing and formatting of matrices as text, split into chunks of lines
+// which are handled in parallel
+// NOTE: this is an implementation detail, not part of the public API
+namespace com::saxbophone::gryde::detail {
+    // fewest bytes of text given to each parsing task
+    inline constexpr std::size_t TEXT_CHUNK_SIZE = 1 << 20;
+    // most tasks per thread of a pool, enough to balance uneven lines
+    inline constexpr std::size_t TEXT_TASKS_PER_THREAD = 4;
+    // number of values formatted by each writing task
+    inline constexpr std::size_t TEXT_CHUNK_ITEMS = 1 << 14;
+
+    // element types which can be read from and written as text
+    template <typename T>
+    concept TextCell = std::is_arithmetic_v<T> and not std::is_same_v<T, bool>;
+
+    // calls body(i) for each i in [0, count), in parallel on pool if it's not
+    // null
+    template <typename Body>
+    void text_for(ThreadPool* pool, std::size_t count, const Body& body) {
+        if (pool == nullptr or count < 2) {
+            for (std::size_t i = 0; i < count; i++) {
+                body(i);
+            }
+        } else {
+            pool->parallel_for(count, body);
+        }
+    }
+
+    constexpr bool is_blank(char c) {
+        return c == ' ' or c == '\t' or c == '\r';
+    }
+
+    // whether a line has nothing but whitespace on it
+    constexpr bool is_blank_line(std::string_view line) {
+        return std::all_of(line.begin(), line.end(), is_blank);
+    }
+
+    // removes the whitespace either side of text
+    constexpr std::string_view trim(std::string_view text) {
+        while (not text.empty() and is_blank(text.front())) {
+            text.remove_prefix(1);
+        }
+        while (not text.empty() and is_blank(text.back())) {
+            text.remove_suffix(1);
+        }
+        return text;
+    }
+
+    // takes the next line (without its line ending) off the front of text
+    constexpr std::string_view next_line(std::string_view& text) {
+        const std::size_t end = std::min(text.find('\n'), text.size());
+        std::string_view line = text.substr(0, end);
+        text.remove_prefix(std::min(end + 1, text.size()));
+        if (not line.empty() and line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    // takes the next whitespace-separated token off the front of text
+    constexpr std::string_view next_token(std::string_view& text) {
+        text = trim(text);
+        const std::size_t end = std::min(text.find_first_of(" \t\r"), text.size());
+        std::string_view token = text.substr(0, end);
+        text.remove_prefix(end);
+        return token;
+    }
+
+    // the whole of token as a number of type T, which may have a leading '+'
+    template <TextCell T>
+    T parse_number(std::string_view token) {
+        if (token.size() > 1 and token.front() == '+' and token[1] != '-') {
+            token.remove_prefix(1);
+        }
+        T value{};
+        auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (error != std::errc() or end != token.data() + token.size() or token.empty()) {
+            throw std::runtime_error("Matrix text value can't be parsed");
+        }
+        return value;
+    }
+
+    // appends value to out, in the shortest form which parses back the same
+    template <TextCell T>
+    void append_number(std::string& out, T value) {
+        char buffer[64];
+        auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        (void)error; // the buffer fits any arithmetic value
+        out.append(buffer, end);
+    }
+
+    // text split into chunks which start at the start of a line, each knowing
+    // the index of its first non-blank line
+    struct TextChunks {
+        std::vector<std::string_view> chunks;
+        std::vector<std::size_t> first_lines;
+        // the number of non-blank lines in all of the chunks
+        std::size_t line_count = 0;
+    };
+
+    // splits text into chunks of at least chunk_size bytes for parsing in
+    // parallel on pool (if it's not null), counting their lines in parallel too
+    inline TextChunks split_lines(ThreadPool* pool, std::string_view text, std::size_t chunk_size = TEXT_CHUNK_SIZE) {
+        std::size_t tasks = 1;
+        if (pool != nullptr) {
+            tasks = std::clamp<std::size_t>(
+                text.size() / chunk_size, 1, TEXT_TASKS_PER_THREAD * (pool->worker_count() + 1)
+            );
+        }
+        TextChunks split;
+        std::size_t begin = 0;
+        for (std::size_t task = 0; task < tasks; task++) {
+            // move each boundary on to the start of the next line
+            std::size_t end = task + 1 == tasks ? text.size() : text.size() / tasks * (task + 1);
+            if (end < text.size()) {
+                end = std::min(text.find('\n', std::max(end, begin)), text.size() - 1) + 1;
+            }
+            if (end > begin) {
+                split.chunks.push_back(text.substr(begin, end - begin));
+            }
+            begin = end;
+        }
+        split.first_lines.resize(split.chunks.size());
+        text_for(pool, split.chunks.size(), [&](std::size_t c) {
+            std::string_view chunk = split.chunks[c];
+            std::size_t lines = 0;
+            while (not chunk.empty()) {
+                if (not is_blank_line(next_line(chunk))) {
+                    lines++;
+                }
+            }
+            split.first_lines[c] = lines;
+        });
+        // the counts become the index of the first line of each chunk
+        for (std::size_t& lines : split.first_lines) {
+            split.line_count += std::exchange(lines, split.line_count);
+        }
+        return split;
+    }
+
+    // calls body(c, index, line) for each non-blank line of the chunks, where
+    // c is the chunk it's in, with the chunks in parallel on pool if it's not
+    // null
+    template <typename Body>
+    void for_each_chunk_line(ThreadPool* pool, const TextChunks& split, const Body& body) {
+        text_for(pool, split.chunks.size(), [&](std::size_t c) {
+            std::string_view chunk = split.chunks[c];
+            std::size_t index = split.first_lines[c];
+            while (not chunk.empty()) {
+                std::string_view line = next_line(chunk);
+                if (not is_blank_line(line)) {
+                    body(c, index++, line);
+                }
+            }
+        });
+    }
+
+    // calls body(index, line) for each non-blank line of the chunks, with the
+    // chunks in parallel on pool if it's not null
+    template <typename Body>
+    void for_each_line(ThreadPool* pool, const TextChunks& split, const Body& body) {
+        for_each_chunk_line(pool, split, [&](std::size_t, std::size_t index, std::string_view line) {
+            body(index, line);
+        });
+    }
+
+    // writes count items to file, formatted by format(begin, end, out), which
+    // appends items [begin, end) to out
+    // chunks of chunk_items items are formatted in parallel on pool if it's
+    // not null, a round of them at a time, so the whole text is never held in
+    // memory
+    template <typename Format>
+    void write_text(
+        ThreadPool* pool, std::ostream& file, std::size_t count, std::size_t chunk_items, const Format& format
+    ) {
+        const std::size_t chunks = (count + chunk_items - 1) / chunk_items;
+        const std::size_t round = pool == nullptr ? 1 : TEXT_TASKS_PER_THREAD * (pool->worker_count() + 1);
+        std::vector<std::string> texts(std::min(round, chunks));
+        for (std::size_t first = 0; first < chunks; first += round) {
+            const std::size_t tasks = std::min(round, chunks - first);
+            text_for(pool, tasks, [&](std::size_t task) {
+                const std::size_t begin = (first + task) * chunk_items;
+                texts[task].clear();
+                format(begin, std::min(begin + chunk_items, count), texts[task]);
+            });
+            for (std::size_t task = 0; task < tasks; task++) {
+                file << texts[task];
+            }
+        }
+        if (not file.flush()) {
+            throw std::runtime_error("Matrix file can't be written");
+        }
+    }
+} // namespace com::saxbophone::gryde::detail
+#endif // include guard
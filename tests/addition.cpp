@@ -11,7 +11,7 @@ SCENARIO("Adding fixed-size Matrix to fixed-size Matrix") {
         GIVEN("Another zero-sized fixed-size Matrx") {
             Matrix<int, 0, 0> b;
             THEN("The two matrices can be added together, giving another empty Matrix") {
-                Matrix<int, 0, 0> c = a + b;
+                [[maybe_unused]] Matrix<int, 0, 0> c = a + b;
                 SUCCEED();
             }
         }
@@ -49,7 +49,7 @@ SCENARIO("Adding fixed-size Matrix to dynamic-size Matrix") {
         GIVEN("A zero-sized dynamic-size Matrx") {
             Matrix<int> b(0, 0);
             THEN("The two matrices can be added together, giving another empty Matrix of fixed-size") {
-                Matrix<int, 0, 0> c = a + b;
+                [[maybe_unused]] Matrix<int, 0, 0> c = a + b;
                 SUCCEED();
             }
         }
@@ -140,7 +140,7 @@ SCENARIO("Adding dynamic-size Matrix to fixed-size Matrix") {
         GIVEN("A zero-sized fixed-size Matrx") {
             Matrix<int, 0, 0> b;
             THEN("The two matrices can be added together, giving another empty Matrix of fixed-size") {
-                Matrix<int, 0, 0> c = a + b;
+                [[maybe_unused]] Matrix<int, 0, 0> c = a + b;
                 SUCCEED();
             }
         }
@@ -0,0 +1,147 @@
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/AlignedAllocator.hpp>
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// memory resource which counts the allocations made through it
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0;
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+static bool is_aligned(const void* p, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+SCENARIO("Dynamic-size Matrix cells are aligned to a cache line by default") {
+    GIVEN("Dynamic-size matrices too large to store their cells inline") {
+        auto size = GENERATE(as<std::size_t>(), 5, 17, 100);
+        Matrix<char> bytes(size, size);
+        Matrix<double> doubles(size, size);
+        THEN("Their cells start on a cache line boundary") {
+            CHECK(is_aligned(bytes.contents().data(), CACHE_LINE_SIZE));
+            CHECK(is_aligned(doubles.contents().data(), CACHE_LINE_SIZE));
+        }
+    }
+    GIVEN("A std::vector using an AlignedAllocator with a larger alignment") {
+        std::vector<int, AlignedAllocator<int, 256>> cells(10);
+        THEN("Its storage has that alignment") {
+            CHECK(is_aligned(cells.data(), 256));
+        }
+    }
+}
+
+SCENARIO("Dynamic-size Matrix with cells from a memory resource") {
+    GIVEN("A memory resource") {
+        CountingResource resource;
+        WHEN("Matrices are made using it") {
+            pmr::Matrix<int> a(2, 2, {{1, 2,}, {3, 4,},}, &resource);
+            pmr::Matrix<int> b(5, 5, &resource);
+            pmr::Matrix<int> c(5, 5, &resource);
+            THEN("The cells of those too large to store them inline are allocated from it") {
+                CHECK(resource.allocations == 2);
+                CHECK(a.get_allocator().resource() == &resource);
+            }
+            THEN("Results of multiplying and transposing them are allocated from it") {
+                pmr::Matrix<int> d = b * c;
+                pmr::Matrix<int> e = b.transpose();
+                CHECK(d.get_allocator().resource() == &resource);
+                CHECK(e.get_allocator().resource() == &resource);
+                CHECK(resource.allocations == 4);
+            }
+            THEN("Their submatrices are allocated from it") {
+                pmr::Matrix<int> f(6, 6, &resource);
+                pmr::Matrix<int> g = f.submatrix(1, 2);
+                CHECK(g.get_allocator().resource() == &resource);
+                CHECK(resource.allocations == 4);
+            }
+            THEN("They can be used with matrices using the default allocator") {
+                Matrix<int> e(2, 2, {{5, 6,}, {7, 8,},});
+                Matrix<int> sum = a + e;
+                pmr::Matrix<int> product = a * e;
+                CHECK(sum == Matrix<int>(2, 2, {{6, 8,}, {10, 12,},}));
+                CHECK(product == Matrix<int>(2, 2, {{19, 22,}, {43, 50,},}));
+                CHECK(Matrix<int>(a) == a);
+            }
+        }
+    }
+    GIVEN("A monotonic buffer resource backed by a fixed buffer") {
+        std::byte buffer[8192];
+        std::pmr::monotonic_buffer_resource arena(
+            buffer, sizeof(buffer), std::pmr::null_memory_resource()
+        );
+        THEN("Many short-lived matrices can be made without touching the heap") {
+            for (std::size_t i = 0; i < 10; i++) {
+                pmr::Matrix<double> matrix(8, 8, &arena);
+                matrix(i % 8, i % 8) = static_cast<double>(i);
+                CHECK(matrix.contents().data() >= static_cast<void*>(buffer));
+                CHECK(matrix.contents().data() < static_cast<void*>(buffer + sizeof(buffer)));
+            }
+        }
+    }
+}
+
+// moving cells between unequal memory resources has to allocate, so can throw
+static_assert(std::is_nothrow_move_assignable_v<Matrix<int>>);
+static_assert(not std::is_nothrow_move_assignable_v<pmr::Matrix<int>>);
+
+SCENARIO("Dynamic-size Matrix moved between different memory resources") {
+    GIVEN("A matrix with its cells allocated from one memory resource") {
+        CountingResource source_resource;
+        pmr::Matrix<int> source(30, 30, &source_resource);
+        source(29, 29) = 7;
+        WHEN("It is moved into a matrix using another memory resource") {
+            CountingResource target_resource;
+            pmr::Matrix<int> target(2, 2, &target_resource);
+            target = std::move(source);
+            THEN("The cells are allocated from the other memory resource") {
+                CHECK(target.get_allocator().resource() == &target_resource);
+                CHECK(target_resource.allocations == 1);
+                CHECK(target(29, 29) == 7);
+            }
+        }
+        WHEN("It is moved into a matrix using a memory resource which can't allocate") {
+            pmr::Matrix<int> target(2, 2, std::pmr::null_memory_resource());
+            THEN("An exception is thrown") {
+                CHECK_THROWS_AS(target = std::move(source), std::bad_alloc);
+            }
+        }
+    }
+}
+
+SCENARIO("Dynamic-size Matrix copied into a memory resource which can't allocate") {
+    GIVEN("A matrix too large to store its cells inline and a small one using such a resource") {
+        pmr::Matrix<int> source(30, 30);
+        pmr::Matrix<int> target(2, 2, {{1, 2,}, {3, 4,},}, std::pmr::null_memory_resource());
+        WHEN("The large one is copied into the small one") {
+            CHECK_THROWS_AS(target = source, std::bad_alloc);
+            THEN("The cells of the small one are left as they were") {
+                REQUIRE(target.contents().size() == 4);
+                CHECK(target.contents()[0] == 1);
+                CHECK(target.contents()[3] == 4);
+            }
+        }
+    }
+}
@@ -0,0 +1,215 @@
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/AlignedAllocator.hpp>
+#include <gryde/Batch.hpp>
+#include <gryde/Execution.hpp>
+#include <gryde/Layout.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/ThreadPool.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// makes a batch of fixed-size matrices with small integer contents, so that
+// arithmetic on them is exact even in floating-point
+template <typename T, std::size_t M, std::size_t N, Layout L = Layout::ROW_MAJOR>
+static std::vector<Matrix<T, M, N, AlignedAllocator<T>, L>> make_batch(std::size_t count, int seed) {
+    std::vector<Matrix<T, M, N, AlignedAllocator<T>, L>> batch(count);
+    int value = seed;
+    for (auto& matrix : batch) {
+        for (auto& cell : matrix.contents()) {
+            value = (value * 7 + 3) % 19;
+            cell = static_cast<T>(value - 9);
+        }
+        // keep them well away from singular
+        for (std::size_t i = 0; i < M and i < N; i++) {
+            matrix(i, i) += static_cast<T>(40);
+        }
+    }
+    return batch;
+}
+
+SCENARIO("Multiplying batches of matrices") {
+    GIVEN("Batches of 4x4 float and 3x3 double matrices of some size") {
+        // sizes chosen to exercise whole vectors, ragged ends and many tasks
+        auto count = GENERATE(as<std::size_t>(), 0, 1, 7, 1000, 3001);
+        auto a = make_batch<float, 4, 4>(count, 1);
+        auto b = make_batch<float, 4, 4>(count, 2);
+        auto c = make_batch<double, 3, 3>(count, 3);
+        auto d = make_batch<double, 3, 3>(count, 4);
+        AND_GIVEN("A ThreadPool") {
+            ThreadPool pool(3);
+            THEN("Multiplying them gives the same as multiplying each pair") {
+                std::vector<Matrix<float, 4, 4>> ab(count);
+                std::vector<Matrix<double, 3, 3>> cd(count);
+                batch::multiply(std::span<const Matrix<float, 4, 4>>(a), b, ab);
+                batch::multiply(execution::par.on(pool), c, d, std::span<Matrix<double, 3, 3>>(cd));
+                for (std::size_t i = 0; i < count; i++) {
+                    CHECK(ab[i] == a[i] * b[i]);
+                    CHECK(cd[i] == c[i] * d[i]);
+                }
+            }
+        }
+    }
+    GIVEN("Batches of non-square integer matrices") {
+        auto a = make_batch<int, 2, 3>(100, 5);
+        auto b = make_batch<int, 3, 5>(100, 6);
+        THEN("Multiplying them gives the same as multiplying each pair") {
+            std::vector<Matrix<int, 2, 5>> ab(100);
+            batch::multiply(execution::seq, a, b, ab);
+            for (std::size_t i = 0; i < 100; i++) {
+                CHECK(ab[i] == a[i] * b[i]);
+            }
+        }
+        THEN("Multiplying into an output of the wrong size throws an exception") {
+            std::vector<Matrix<int, 2, 5>> ab(99);
+            CHECK_THROWS_AS(batch::multiply(a, b, ab), std::runtime_error);
+        }
+    }
+}
+
+SCENARIO("Determinants of batches of matrices") {
+    GIVEN("Batches of square matrices of some size and a ThreadPool") {
+        auto count = GENERATE(as<std::size_t>(), 0, 1, 7, 3001);
+        ThreadPool pool(3);
+        auto a = make_batch<float, 4, 4>(count, 1);
+        auto b = make_batch<double, 2, 2>(count, 2);
+        auto c = make_batch<long long, 3, 3>(count, 3);
+        auto d = make_batch<double, 6, 6>(count, 4);
+        THEN("Their determinants are those of each Matrix") {
+            std::vector<float> a_determinants(count);
+            std::vector<double> b_determinants(count);
+            std::vector<long long> c_determinants(count);
+            std::vector<double> d_determinants(count);
+            batch::determinant(a, a_determinants);
+            batch::determinant(execution::par.on(pool), b, b_determinants);
+            batch::determinant(execution::par.on(pool), c, c_determinants);
+            batch::determinant(execution::seq, d, d_determinants);
+            for (std::size_t i = 0; i < count; i++) {
+                CHECK(a_determinants[i] == Approx(a[i].determinant()));
+                CHECK(b_determinants[i] == b[i].determinant());
+                CHECK(c_determinants[i] == c[i].determinant());
+                CHECK(d_determinants[i] == d[i].determinant());
+            }
+        }
+    }
+    GIVEN("Batches of 4x4 integer matrices with small and large cells") {
+        auto small = make_batch<long long, 4, 4>(300, 5);
+        auto large = small;
+        for (auto& matrix : large) {
+            matrix *= 10;
+        }
+        THEN("Their determinants are those of each Matrix") {
+            std::vector<long long> small_determinants(300);
+            std::vector<long long> large_determinants(300);
+            batch::determinant(small, small_determinants);
+            batch::determinant(large, large_determinants);
+            for (std::size_t i = 0; i < 300; i++) {
+                CHECK(small_determinants[i] == small[i].determinant());
+                CHECK(large_determinants[i] == large[i].determinant());
+            }
+        }
+    }
+    GIVEN("A batch of 4x4 integer matrices with one whose determinant overflows") {
+        auto a = make_batch<long long, 4, 4>(300, 6);
+        for (std::size_t i = 0; i < 4; i++) {
+            a[123](i, i) = 1LL << 40;
+        }
+        THEN("Taking their determinants throws an exception, as for the Matrix on its own") {
+            std::vector<long long> determinants(300);
+            CHECK_THROWS_AS(batch::determinant(a, determinants), std::overflow_error);
+        }
+    }
+}
+
+SCENARIO("Inverses of batches of matrices") {
+    GIVEN("Batches of square matrices of some size and a ThreadPool") {
+        auto count = GENERATE(as<std::size_t>(), 0, 1, 7, 3001);
+        ThreadPool pool(3);
+        auto a = make_batch<float, 4, 4>(count, 1);
+        auto b = make_batch<double, 3, 3>(count, 2);
+        auto c = make_batch<double, 5, 5>(count, 3);
+        THEN("Each Matrix multiplied by its inverse is the identity") {
+            std::vector<Matrix<float, 4, 4>> a_inverses(count);
+            std::vector<Matrix<double, 3, 3>> b_inverses(count);
+            std::vector<Matrix<double, 5, 5>> c_inverses(count);
+            batch::inverse(a, a_inverses);
+            batch::inverse(execution::par.on(pool), b, b_inverses);
+            batch::inverse(execution::par.on(pool), c, c_inverses);
+            for (std::size_t i = 0; i < count; i++) {
+                auto a_identity = a[i] * a_inverses[i];
+                auto b_identity = b[i] * b_inverses[i];
+                auto c_identity = c[i] * c_inverses[i];
+                for (std::size_t m = 0; m < 5; m++) {
+                    for (std::size_t n = 0; n < 5; n++) {
+                        double expected = m == n ? 1.0 : 0.0;
+                        if (m < 4 and n < 4) {
+                            CHECK(a_identity(m, n) == Approx(expected).margin(1e-5));
+                        }
+                        if (m < 3 and n < 3) {
+                            CHECK(b_identity(m, n) == Approx(expected).margin(1e-12));
+                        }
+                        CHECK(c_identity(m, n) == Approx(expected).margin(1e-12));
+                    }
+                }
+            }
+        }
+    }
+    GIVEN("A batch with a singular Matrix in it") {
+        auto small = make_batch<double, 2, 2>(20, 1);
+        auto large = make_batch<double, 5, 5>(20, 1);
+        small[13] = Matrix<double, 2, 2>{{1.0, 2.0,}, {2.0, 4.0,},};
+        large[13] = Matrix<double, 5, 5>{};
+        THEN("Inverting the batch throws an exception") {
+            std::vector<Matrix<double, 2, 2>> small_inverses(20);
+            std::vector<Matrix<double, 5, 5>> large_inverses(20);
+            CHECK_THROWS_AS(batch::inverse(small, small_inverses), std::runtime_error);
+            CHECK_THROWS_AS(batch::inverse(large, large_inverses), std::runtime_error);
+        }
+    }
+}
+
+SCENARIO("Batches of column-major matrices") {
+    GIVEN("Batches of column-major 3x3 double matrices") {
+        auto a = make_batch<double, 3, 3, Layout::COLUMN_MAJOR>(100, 1);
+        auto b = make_batch<double, 3, 3, Layout::COLUMN_MAJOR>(100, 2);
+        THEN("Multiplying, taking determinants and inverting them gives the same as for each Matrix") {
+            std::vector<ColumnMajorMatrix<double, 3, 3>> products(100);
+            std::vector<double> determinants(100);
+            std::vector<ColumnMajorMatrix<double, 3, 3>> inverses(100);
+            batch::multiply(a, b, products);
+            batch::determinant(a, determinants);
+            batch::inverse(a, inverses);
+            for (std::size_t i = 0; i < 100; i++) {
+                CHECK(products[i] == a[i] * b[i]);
+                CHECK(determinants[i] == Approx(a[i].determinant()));
+                auto identity = a[i] * inverses[i];
+                for (std::size_t m = 0; m < 3; m++) {
+                    for (std::size_t n = 0; n < 3; n++) {
+                        CHECK(identity(m, n) == Approx(m == n ? 1.0 : 0.0).margin(1e-12));
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Transposing batches of matrices") {
+    GIVEN("A batch of non-square matrices and a ThreadPool") {
+        ThreadPool pool(3);
+        auto a = make_batch<int, 3, 4>(3001, 1);
+        THEN("Their transposes are those of each Matrix") {
+            std::vector<Matrix<int, 4, 3>> transposes(3001);
+            batch::transpose(execution::par.on(pool), a, transposes);
+            for (std::size_t i = 0; i < a.size(); i++) {
+                CHECK(transposes[i] == a[i].transpose());
+            }
+        }
+    }
+}
@@ -17,8 +17,8 @@ SCENARIO("Get cell of zero-size fixed Matrix") {
 SCENARIO("Get cell of zero-size dynamic Matrix") {
     GIVEN("A dynamic Matrix of zero-size") {
         Matrix<int> matrix(0, 0);
-        THEN("Using function-call operator to get any cell throws an exception") {
-            CHECK_THROWS(matrix(0, 0));
+        THEN("Using Matrix.at() to get any cell throws an exception") {
+            CHECK_THROWS(matrix.at(0, 0));
         }
     }
 }
@@ -34,10 +34,14 @@ SCENARIO("Get cell of non-zero-size fixed Matrix") {
             int cell = matrix(1, 1);
             CHECK(cell == 4);
         }
-        THEN("Using the function-call operator with out-of-bounds indices throws an exception") {
-            CHECK_THROWS(matrix(2, 4)); // 4 out of bounds
-            CHECK_THROWS(matrix(9, 1)); // 9 out of bounds
-            CHECK_THROWS(matrix(2000, 1000)); // both out of bounds
+        THEN("A single cell of the Matrix can be retrieved using Matrix.at()") {
+            int cell = matrix.at(2, 0);
+            CHECK(cell == 6);
+        }
+        THEN("Using Matrix.at() with out-of-bounds indices throws an exception") {
+            CHECK_THROWS(matrix.at(2, 4)); // 4 out of bounds
+            CHECK_THROWS(matrix.at(9, 1)); // 9 out of bounds
+            CHECK_THROWS(matrix.at(2000, 1000)); // both out of bounds
         }
     }
 }
@@ -56,10 +60,14 @@ SCENARIO("Get cell of non-zero-size dynamic Matrix") {
             int cell = matrix(1, 1);
             CHECK(cell == 4);
         }
-        THEN("Using the function-call operator with out-of-bounds indices throws an exception") {
-            CHECK_THROWS(matrix(2, 4)); // 4 out of bounds
-            CHECK_THROWS(matrix(9, 1)); // 9 out of bounds
-            CHECK_THROWS(matrix(2000, 1000)); // both out of bounds
+        THEN("A single cell of the Matrix can be retrieved using Matrix.at()") {
+            int cell = matrix.at(2, 0);
+            CHECK(cell == 6);
+        }
+        THEN("Using Matrix.at() with out-of-bounds indices throws an exception") {
+            CHECK_THROWS(matrix.at(2, 4)); // 4 out of bounds
+            CHECK_THROWS(matrix.at(9, 1)); // 9 out of bounds
+            CHECK_THROWS(matrix.at(2000, 1000)); // both out of bounds
         }
     }
 }
@@ -76,8 +84,8 @@ SCENARIO("Set cell of zero-size fixed Matrix") {
 SCENARIO("Set cell of zero-size dynamic Matrix") {
     GIVEN("A dynamic Matrix of zero-size") {
         Matrix<int> matrix(0, 0);
-        THEN("Using function-call operator to set any cell throws an exception") {
-            CHECK_THROWS(matrix(0, 0) = 9);
+        THEN("Using Matrix.at() to set any cell throws an exception") {
+            CHECK_THROWS(matrix.at(0, 0) = 9);
         }
     }
 }
@@ -93,10 +101,16 @@ SCENARIO("Set cell of non-zero-size fixed Matrix") {
                 CHECK(matrix(1, 2) == 467);
             }
         }
-        THEN("Trying to set an out of bounds cell throws an exception") {
-            CHECK_THROWS(matrix(2, 4) = 23); // 4 out of bounds
-            CHECK_THROWS(matrix(9, 1) = 19); // 9 out of bounds
-            CHECK_THROWS(matrix(2000, 1000) = 7); // both out of bounds
+        WHEN("A single cell is set to a value using Matrix.at()") {
+            matrix.at(0, 1) = 19;
+            THEN("That cell now has that value") {
+                CHECK(matrix(0, 1) == 19);
+            }
+        }
+        THEN("Trying to set an out of bounds cell with Matrix.at() throws an exception") {
+            CHECK_THROWS(matrix.at(2, 4) = 23); // 4 out of bounds
+            CHECK_THROWS(matrix.at(9, 1) = 19); // 9 out of bounds
+            CHECK_THROWS(matrix.at(2000, 1000) = 7); // both out of bounds
         }
     }
 }
@@ -112,10 +126,16 @@ SCENARIO("Set cells of non-zero-size dynamic Matrix") {
                 CHECK(matrix(1, 2) == 467);
             }
         }
-        THEN("Trying to set an out of bounds cell throws an exception") {
-            CHECK_THROWS(matrix(2, 4) = 23); // 4 out of bounds
-            CHECK_THROWS(matrix(9, 1) = 19); // 9 out of bounds
-            CHECK_THROWS(matrix(2000, 1000) = 7); // both out of bounds
+        WHEN("A single cell is set to a value using Matrix.at()") {
+            matrix.at(0, 1) = 19;
+            THEN("That cell now has that value") {
+                CHECK(matrix(0, 1) == 19);
+            }
+        }
+        THEN("Trying to set an out of bounds cell with Matrix.at() throws an exception") {
+            CHECK_THROWS(matrix.at(2, 4) = 23); // 4 out of bounds
+            CHECK_THROWS(matrix.at(9, 1) = 19); // 9 out of bounds
+            CHECK_THROWS(matrix.at(2000, 1000) = 7); // both out of bounds
         }
     }
 }
@@ -0,0 +1,105 @@
+#include <stdexcept>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// makes a fixed-size Matrix with a predictable, non-uniform pattern of small
+// integer contents, well away from singular
+template <typename T, std::size_t M, std::size_t N>
+static Matrix<T, M, N> make_patterned(int seed) {
+    Matrix<T, M, N> matrix;
+    int value = seed;
+    for (auto& cell : matrix.contents()) {
+        value = (value * 7 + 3) % 19;
+        cell = static_cast<T>(value - 9);
+    }
+    for (std::size_t i = 0; i < M and i < N; i++) {
+        matrix(i, i) += static_cast<T>(20);
+    }
+    return matrix;
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "Closed-form kernels for small fixed-size matrices agree with the general ones", "",
+    ((std::size_t S), S), 1, 2, 3, 4
+) {
+    auto a = make_patterned<long long, S, S>(1);
+    auto b = make_patterned<long long, S, S>(2);
+    // dynamic-size matrices always use the general kernels
+    Matrix<long long> x(a);
+    Matrix<long long> y(b);
+    THEN("Multiplication gives the same product") {
+        CHECK(a * b == x * y);
+    }
+    THEN("Transposition gives the same transpose") {
+        CHECK(a.transpose() == x.transpose());
+    }
+    THEN("The determinant is the same") {
+        CHECK(a.determinant() == x.determinant());
+        CHECK(b.determinant() == y.determinant());
+    }
+    THEN("The inverse multiplied by the Matrix is the identity") {
+        auto c = make_patterned<double, S, S>(3);
+        auto identity = c * c.inverse();
+        for (std::size_t m = 0; m < S; m++) {
+            for (std::size_t n = 0; n < S; n++) {
+                CHECK(identity(m, n) == Approx(m == n ? 1.0 : 0.0).margin(1e-12));
+            }
+        }
+    }
+}
+
+SCENARIO("Multiplying and transposing small non-square matrices") {
+    GIVEN("Two small non-square matrices") {
+        auto a = make_patterned<int, 2, 4>(4);
+        auto b = make_patterned<int, 4, 3>(5);
+        THEN("Their product and transposes are the same as the general kernels give") {
+            CHECK(a * b == Matrix<int>(a) * Matrix<int>(b));
+            CHECK(a.transpose() == Matrix<int>(a).transpose());
+            CHECK(b.transpose() == Matrix<int>(b).transpose());
+        }
+    }
+}
+
+SCENARIO("Inverting fixed-size matrices") {
+    GIVEN("A 4x4 Matrix with a known inverse") {
+        Matrix<double, 4, 4> matrix = {
+            {1.0, 1.0, 1.0, -1.0,},
+            {1.0, 1.0, -1.0, 1.0,},
+            {1.0, -1.0, 1.0, 1.0,},
+            {-1.0, 1.0, 1.0, 1.0,},
+        };
+        THEN("Its inverse is correct") {
+            CHECK(matrix.inverse() == matrix * 0.25);
+        }
+    }
+    GIVEN("A Matrix too large for the closed-form inverse") {
+        auto matrix = make_patterned<double, 6, 6>(6);
+        THEN("The inverse multiplied by the Matrix is the identity") {
+            auto identity = matrix.inverse() * matrix;
+            for (std::size_t m = 0; m < 6; m++) {
+                for (std::size_t n = 0; n < 6; n++) {
+                    CHECK(identity(m, n) == Approx(m == n ? 1.0 : 0.0).margin(1e-12));
+                }
+            }
+        }
+    }
+    GIVEN("Singular matrices") {
+        Matrix<double, 3, 3> small = {
+            {1.0, 2.0, 3.0,},
+            {2.0, 4.0, 6.0,},
+            {0.0, 1.0, 5.0,},
+        };
+        Matrix<double, 5, 5> large;
+        THEN("Inverting them throws an exception") {
+            CHECK_THROWS_AS(small.inverse(), std::runtime_error);
+            CHECK_THROWS_AS(large.inverse(), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,166 @@
+#include <memory_resource>
+#include <utility>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// memory resource which counts the allocations made through it
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0;
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+SCENARIO("Compound assignment to fixed-size Matrix") {
+    GIVEN("Two fixed-size matrices with some contents") {
+        Matrix<int, 2, 2> a = {
+            {1, 2,},
+            {3, 4,},
+        };
+        Matrix<int, 2, 2> b = {
+            {5, 6,},
+            {7, 8,},
+        };
+        THEN("Adding one to the other in place gives their sum") {
+            a += b;
+            CHECK(a == Matrix<int, 2, 2>{{6, 8,}, {10, 12,},});
+        }
+        THEN("Subtracting one from the other in place gives their difference") {
+            a -= b;
+            CHECK(a == Matrix<int, 2, 2>{{-4, -4,}, {-4, -4,},});
+        }
+        THEN("Multiplying one by a scalar in place scales it") {
+            a *= 3;
+            CHECK(a == Matrix<int, 2, 2>{{3, 6,}, {9, 12,},});
+        }
+        THEN("Multiplying one by the other in place gives their product") {
+            a *= b;
+            CHECK(a == Matrix<int, 2, 2>{{19, 22,}, {43, 50,},});
+        }
+        THEN("Compound assignment works with expressions, views and dynamic-size matrices") {
+            a += b - a * 2;
+            CHECK(a == Matrix<int, 2, 2>{{4, 4,}, {4, 4,},});
+            a -= b.view().transpose();
+            CHECK(a == Matrix<int, 2, 2>{{-1, -3,}, {-2, -4,},});
+            a += Matrix<int>(2, 2, {{1, 3,}, {2, 4,},});
+            CHECK(a == Matrix<int, 2, 2>{});
+            CHECK_THROWS(a += Matrix<int>(3, 2));
+        }
+    }
+}
+
+SCENARIO("Compound assignment to dynamic-size Matrix") {
+    GIVEN("Two dynamic-size matrices with some contents") {
+        Matrix<int> a(2, 3, {{1, 2, 3,}, {4, 5, 6,},});
+        Matrix<int> b(2, 3, {{6, 5, 4,}, {3, 2, 1,},});
+        THEN("Adding, subtracting and scaling work in place") {
+            a += b;
+            CHECK(a == Matrix<int>(2, 3, {{7, 7, 7,}, {7, 7, 7,},}));
+            a -= b * 2;
+            CHECK(a == Matrix<int>(2, 3, {{-5, -3, -1,}, {1, 3, 5,},}));
+            a *= -1;
+            CHECK(a == Matrix<int>(2, 3, {{5, 3, 1,}, {-1, -3, -5,},}));
+        }
+        THEN("Multiplying in place replaces the Matrix with the product") {
+            a *= b.view().transpose();
+            CHECK(a == Matrix<int>(2, 2, {{28, 10,}, {73, 28,},}));
+        }
+        THEN("Compound assignment with mismatched dimensions throws an exception") {
+            CHECK_THROWS(a += Matrix<int>(3, 2));
+            CHECK_THROWS(a *= b);
+        }
+    }
+}
+
+SCENARIO("Assigning an expression to a Matrix reuses its cells") {
+    GIVEN("A large accumulator Matrix and another Matrix, allocated from a memory resource") {
+        CountingResource resource;
+        pmr::Matrix<double> accumulator(100, 100, &resource);
+        pmr::Matrix<double> x(100, 100, &resource);
+        for (auto& cell : x.contents()) {
+            cell = 0.5;
+        }
+        const double* cells = accumulator.contents().data();
+        WHEN("The other Matrix is repeatedly added to the accumulator") {
+            for (int i = 0; i < 10; i++) {
+                accumulator = accumulator + x;
+            }
+            THEN("The result is correct") {
+                CHECK(accumulator(99, 99) == 5.0);
+            }
+            THEN("No more memory is allocated") {
+                CHECK(resource.allocations == 2);
+                CHECK(accumulator.contents().data() == cells);
+            }
+        }
+    }
+    GIVEN("A square Matrix") {
+        Matrix<int> matrix(3, 3, {{1, 2, 3,}, {4, 5, 6,}, {7, 8, 9,},});
+        WHEN("A transposed view of itself is assigned to it") {
+            matrix = matrix.view().transpose();
+            THEN("The Matrix is transposed correctly") {
+                CHECK(matrix == Matrix<int>(3, 3, {{1, 4, 7,}, {2, 5, 8,}, {3, 6, 9,},}));
+            }
+        }
+    }
+}
+
+SCENARIO("Arithmetic on expiring matrices reuses their cells") {
+    GIVEN("Two large dynamic-size matrices") {
+        Matrix<int> a(50, 50);
+        Matrix<int> b(50, 50);
+        for (std::size_t i = 0; i < 50; i++) {
+            a(i, i) = 1;
+            b(i, 49 - i) = 2;
+        }
+        THEN("Adding to an expiring Matrix writes the sum into it") {
+            Matrix<int> copy = a;
+            const int* cells = copy.contents().data();
+            Matrix<int> sum = std::move(copy) + b;
+            CHECK(sum.contents().data() == cells);
+            CHECK(sum == Matrix<int>(a + b));
+        }
+        THEN("Subtracting an expiring Matrix writes the difference into it") {
+            Matrix<int> copy = b;
+            const int* cells = copy.contents().data();
+            Matrix<int> difference = a - std::move(copy);
+            CHECK(difference.contents().data() == cells);
+            CHECK(difference == Matrix<int>(a - b));
+        }
+        THEN("Operations on two expiring matrices write the result into the first") {
+            Matrix<int> x = a;
+            Matrix<int> y = b;
+            const int* cells = x.contents().data();
+            Matrix<int> difference = std::move(x) - std::move(y);
+            CHECK(difference.contents().data() == cells);
+            CHECK(difference == Matrix<int>(a - b));
+        }
+        THEN("Scaling an expiring Matrix writes the result into it") {
+            Matrix<int> copy = a;
+            const int* cells = copy.contents().data();
+            Matrix<int> scaled = 3 * std::move(copy);
+            CHECK(scaled.contents().data() == cells);
+            CHECK(scaled == Matrix<int>(a * 3));
+        }
+        THEN("Chained arithmetic on a product works") {
+            Matrix<int> result = a * b + a - b * 2;
+            CHECK(result == Matrix<int>(b + a - b * 2));
+        }
+    }
+}
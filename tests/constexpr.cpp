@@ -1,3 +1,5 @@
+#include <cstddef>
+
 #include <catch2/catch.hpp>
 
 #include <gryde/Matrix.hpp>
@@ -11,7 +13,7 @@ TEST_CASE("constexpr default initialisation") {
 }
 
 TEST_CASE("constexpr list initialisation") {
-    constexpr Matrix<int, 4, 2> matrix = {
+    [[maybe_unused]] constexpr Matrix<int, 4, 2> matrix = {
         {9, 1,},
         {7, 3,},
         {2, 1,},
@@ -22,7 +24,7 @@ TEST_CASE("constexpr list initialisation") {
 
 TEST_CASE("constexpr copy initialisation") {
     constexpr Matrix<int, 9, 7> a;
-    constexpr Matrix<int, 9, 7> b = a;
+    [[maybe_unused]] constexpr Matrix<int, 9, 7> b = a;
     SUCCEED();
 }
 
@@ -82,4 +84,104 @@ TEST_CASE("constexpr determinant") {
     constexpr int determinant = matrix.determinant();
     CHECK(determinant == -93);
 }
+
+TEST_CASE("constexpr multiplication") {
+    constexpr Matrix<int, 2, 3> a = {
+        {1, 2, 3,},
+        {4, 5, 6,},
+    };
+    constexpr Matrix<int, 3, 2> b = {
+        {7, 8,},
+        {9, 10,},
+        {11, 12,},
+    };
+    constexpr Matrix<int, 2, 2> expected = {
+        {58, 64,},
+        {139, 154,},
+    };
+    STATIC_REQUIRE(a * b == expected);
+}
+
+TEST_CASE("constexpr closed-form kernels for small matrices") {
+    constexpr Matrix<double, 4, 4> matrix = {
+        {2.0, 0.0, 0.0, 1.0,},
+        {0.0, 4.0, 0.0, 0.0,},
+        {0.0, 0.0, 8.0, 0.0,},
+        {0.0, 0.0, 0.0, 1.0,},
+    };
+    constexpr Matrix<double, 4, 4> inverse = {
+        {0.5, 0.0, 0.0, -0.5,},
+        {0.0, 0.25, 0.0, 0.0,},
+        {0.0, 0.0, 0.125, 0.0,},
+        {0.0, 0.0, 0.0, 1.0,},
+    };
+    STATIC_REQUIRE(matrix.determinant() == 64.0);
+    STATIC_REQUIRE(matrix.inverse() == inverse);
+    STATIC_REQUIRE(matrix * inverse == Matrix<double, 4, 4>{{1.0,}, {0.0, 1.0,}, {0.0, 0.0, 1.0,}, {0.0, 0.0, 0.0, 1.0,},});
+    STATIC_REQUIRE(matrix.transpose()(3, 0) == 1.0);
+}
+
+// makes a tridiagonal Matrix with 2 on the diagonal and -1 either side of it,
+// the determinant of which is known to be one more than its size
+template <typename T, std::size_t N>
+constexpr Matrix<T, N, N> make_tridiagonal() {
+    Matrix<T, N, N> matrix;
+    for (std::size_t i = 0; i < N; i++) {
+        matrix(i, i) = 2;
+        if (i > 0) {
+            matrix(i, i - 1) = -1;
+            matrix(i - 1, i) = -1;
+        }
+    }
+    return matrix;
+}
+
+TEST_CASE("constexpr determinant of large Matrix") {
+    constexpr Matrix<int, 32, 32> integer = make_tridiagonal<int, 32>();
+    STATIC_REQUIRE(integer.determinant() == 33);
+    constexpr Matrix<double, 32, 32> floating = make_tridiagonal<double, 32>();
+    constexpr double determinant = floating.determinant();
+    STATIC_REQUIRE(determinant > 32.999);
+    STATIC_REQUIRE(determinant < 33.001);
+}
+
+TEST_CASE("constexpr rank of large Matrix") {
+    constexpr Matrix<long long, 32, 32> integer = make_tridiagonal<long long, 32>();
+    STATIC_REQUIRE(integer.rank() == 32);
+    constexpr Matrix<double, 32, 32> floating = make_tridiagonal<double, 32>();
+    STATIC_REQUIRE(floating.rank() == 32);
+}
+
+TEST_CASE("constexpr element-wise arithmetic") {
+    constexpr Matrix<int, 2, 2> a = {
+        {1, 2,},
+        {3, 4,},
+    };
+    constexpr Matrix<int, 2, 2> b = {
+        {5, 6,},
+        {7, 8,},
+    };
+    constexpr Matrix<int, 2, 2> c = (a + b) * 2 - hadamard_product(a, b);
+    constexpr Matrix<int, 2, 2> expected = {
+        {7, 4,},
+        {-1, -8,},
+    };
+    STATIC_REQUIRE(c == expected);
+}
+
+TEST_CASE("constexpr views") {
+    constexpr Matrix<int, 3, 3> matrix = {
+        {1, 2, 3,},
+        {4, 5, 6,},
+        {7, 8, 9,},
+    };
+    constexpr Matrix<int, 2, 2> sub = matrix.view().submatrix(1, 1).transpose();
+    constexpr Matrix<int, 2, 2> expected = {
+        {1, 7,},
+        {3, 9,},
+    };
+    STATIC_REQUIRE(sub == expected);
+    constexpr Matrix<int, 2, 3> removed = matrix.remove_row(0);
+    STATIC_REQUIRE(removed.view().block(1, 2, 1, 1)(0, 0) == 9);
+}
 #endif
@@ -1,3 +1,7 @@
+#include <stdexcept>
+
+#include <cstddef>
+
 #include <catch2/catch.hpp>
 
 #include <gryde/Matrix.hpp>
@@ -66,3 +70,139 @@ SCENARIO("Calculating determinant of square dynamic-size Matrix") {
         }
     }
 }
+
+// makes a tridiagonal Matrix with 2 on the diagonal and -1 either side of it,
+// the determinant of which is known to be one more than its size
+template <typename MatrixType>
+static void populate_tridiagonal(MatrixType& matrix, std::size_t size) {
+    for (std::size_t i = 0; i < size; i++) {
+        matrix(i, i) = 2;
+        if (i > 0) {
+            matrix(i, i - 1) = -1;
+            matrix(i - 1, i) = -1;
+        }
+    }
+}
+
+SCENARIO("Calculating determinant of floating-point fixed-size Matrix") {
+    GIVEN("A square fixed-size Matrix of floating-point values which needs pivoting") {
+        Matrix<double, 4, 4> matrix = {
+            {0.0, 2.0, 1.0, 3.0,},
+            {1.0, 0.0, 4.0, 2.0,},
+            {3.0, 1.0, 0.0, 1.0,},
+            {2.0, 5.0, 1.0, 0.0,},
+        };
+        THEN("Matrix.determinant() returns the determinant of the Matrix") {
+            CHECK(matrix.determinant() == Approx(-164.0));
+        }
+    }
+    GIVEN("A large tridiagonal fixed-size Matrix of floating-point values") {
+        Matrix<double, 20, 20> matrix;
+        populate_tridiagonal(matrix, 20);
+        THEN("Matrix.determinant() returns the determinant of the Matrix") {
+            CHECK(matrix.determinant() == Approx(21.0));
+        }
+    }
+    GIVEN("A singular fixed-size Matrix of floating-point values") {
+        Matrix<float, 4, 4> matrix = {
+            {1.0f, 2.0f, 3.0f, 4.0f,},
+            {2.0f, 4.0f, 6.0f, 8.0f,},
+            {0.0f, 1.0f, 0.0f, 1.0f,},
+            {5.0f, 0.0f, 2.0f, 1.0f,},
+        };
+        THEN("Matrix.determinant() returns zero") {
+            CHECK(matrix.determinant() == 0.0f);
+        }
+    }
+}
+
+SCENARIO("Calculating determinant of floating-point dynamic-size Matrix") {
+    GIVEN("A square dynamic-size Matrix of floating-point values which needs pivoting") {
+        Matrix<double> matrix(
+            4, 4,
+            {
+                {0.0, 2.0, 1.0, 3.0,},
+                {1.0, 0.0, 4.0, 2.0,},
+                {3.0, 1.0, 0.0, 1.0,},
+                {2.0, 5.0, 1.0, 0.0,},
+            }
+        );
+        THEN("Matrix.determinant() returns the determinant of the Matrix") {
+            CHECK(matrix.determinant() == Approx(-164.0));
+        }
+    }
+    GIVEN("A large tridiagonal dynamic-size Matrix of floating-point values") {
+        Matrix<double> matrix(100, 100);
+        populate_tridiagonal(matrix, 100);
+        THEN("Matrix.determinant() returns the determinant of the Matrix") {
+            CHECK(matrix.determinant() == Approx(101.0));
+        }
+    }
+}
+
+SCENARIO("Calculating determinant of integer Matrix by exact elimination") {
+    GIVEN("A square fixed-size Matrix of integers which needs pivoting") {
+        Matrix<int, 4, 4> matrix = {
+            {0, 2, 1, 3,},
+            {1, 0, 4, 2,},
+            {3, 1, 0, 1,},
+            {2, 5, 1, 0,},
+        };
+        THEN("Matrix.determinant() returns the exact determinant of the Matrix") {
+            CHECK(matrix.determinant() == -164);
+        }
+    }
+    GIVEN("A square dynamic-size Matrix of integers with intermediates too large for int") {
+        Matrix<int> matrix(
+            4, 4,
+            {
+                {50000, 49999, 0, 0,},
+                {49999, 49998, 0, 0,},
+                {0, 0, 1, 0,},
+                {0, 0, 0, 1,},
+            }
+        );
+        THEN("Matrix.determinant() returns the exact determinant of the Matrix") {
+            CHECK(matrix.determinant() == -1);
+        }
+    }
+    GIVEN("A large tridiagonal dynamic-size Matrix of long long integers") {
+        Matrix<long long> matrix(60, 60);
+        populate_tridiagonal(matrix, 60);
+        THEN("Matrix.determinant() returns the exact determinant of the Matrix") {
+            CHECK(matrix.determinant() == 61);
+        }
+    }
+    GIVEN("A singular dynamic-size Matrix of integers") {
+        Matrix<long long> matrix(
+            4, 4,
+            {
+                {1, 2, 3, 4,},
+                {2, 4, 6, 8,},
+                {0, 1, 0, 1,},
+                {5, 0, 2, 1,},
+            }
+        );
+        THEN("Matrix.determinant() returns zero") {
+            CHECK(matrix.determinant() == 0);
+        }
+    }
+    GIVEN("A dynamic-size Matrix of long long integers whose determinant overflows") {
+        Matrix<long long> matrix(4, 4);
+        for (std::size_t i = 0; i < 4; i++) {
+            matrix(i, i) = 1LL << 40;
+        }
+        THEN("Matrix.determinant() throws an exception") {
+            CHECK_THROWS_AS(matrix.determinant(), std::overflow_error);
+        }
+    }
+    GIVEN("A fixed-size 4x4 Matrix of long long integers whose determinant overflows") {
+        Matrix<long long, 4, 4> matrix;
+        for (std::size_t i = 0; i < 4; i++) {
+            matrix(i, i) = 1LL << 40;
+        }
+        THEN("Matrix.determinant() throws an exception, as for dynamic-size Matrix") {
+            CHECK_THROWS_AS(matrix.determinant(), std::overflow_error);
+        }
+    }
+}
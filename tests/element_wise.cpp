@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+SCENARIO("Subtracting matrices") {
+    GIVEN("A fixed-size Matrix with some contents") {
+        Matrix<int, 2, 2> a = {
+            {9, 3,},
+            {1, 12,},
+        };
+        AND_GIVEN("A dynamic-size Matrix with the same dimensions and some contents") {
+            Matrix<int> b(
+                2, 2,
+                {
+                    {3, 17,},
+                    {1, 2,},
+                }
+            );
+            WHEN("One is subtracted from the other") {
+                Matrix<int, 2, 2> c = a - b;
+                THEN("The result is the element-wise difference of the two matrices") {
+                    Matrix<int, 2, 2> expected = {
+                        {6, -14,},
+                        {0, 10,},
+                    };
+                    CHECK(c == expected);
+                }
+            }
+        }
+        AND_GIVEN("A dynamic-size Matrix with different dimensions") {
+            Matrix<int> b(3, 2);
+            THEN("Attempting to subtract one from the other throws an exception") {
+                CHECK_THROWS(a - b);
+            }
+        }
+    }
+}
+
+SCENARIO("Multiplying a Matrix by a scalar") {
+    GIVEN("A dynamic-size Matrix with some contents") {
+        Matrix<int> a(
+            2, 3,
+            {
+                {1, 2, 3,},
+                {4, 5, 6,},
+            }
+        );
+        THEN("Multiplying it by a scalar on either side multiplies every cell") {
+            Matrix<int> expected(
+                2, 3,
+                {
+                    {3, 6, 9,},
+                    {12, 15, 18,},
+                }
+            );
+            CHECK(Matrix<int>(a * 3) == expected);
+            CHECK(Matrix<int>(3 * a) == expected);
+        }
+    }
+}
+
+SCENARIO("Calculating the Hadamard product of matrices") {
+    GIVEN("Two fixed-size matrices with the same dimensions and some contents") {
+        Matrix<int, 2, 3> a = {
+            {1, 2, 3,},
+            {4, 5, 6,},
+        };
+        Matrix<int, 2, 3> b = {
+            {7, 8, 9,},
+            {-1, 0, 2,},
+        };
+        THEN("hadamard_product() returns their element-wise product") {
+            Matrix<int, 2, 3> expected = {
+                {7, 16, 27,},
+                {-4, 0, 12,},
+            };
+            CHECK(Matrix<int, 2, 3>(hadamard_product(a, b)) == expected);
+        }
+    }
+}
+
+SCENARIO("Chaining element-wise operations on matrices") {
+    GIVEN("Several dynamic-size matrices with the same dimensions and some contents") {
+        Matrix<int> a(2, 2, {{1, 2,}, {3, 4,},});
+        Matrix<int> b(2, 2, {{5, 6,}, {7, 8,},});
+        Matrix<int> c(2, 2, {{9, 10,}, {11, 12,},});
+        Matrix<int> d(2, 2, {{-1, 0,}, {1, 2,},});
+        WHEN("A chain of element-wise operations is evaluated into a Matrix") {
+            Matrix<int> result = (a + b + c - d) * 2 + hadamard_product(a, d);
+            THEN("The result is the same as evaluating each operation in turn") {
+                Matrix<int> expected(2, 2, {{31, 36,}, {43, 52,},});
+                CHECK(result == expected);
+            }
+        }
+        WHEN("A chain of element-wise operations is evaluated into a fixed-size Matrix") {
+            Matrix<int, 2, 2> result = a + b + c + d;
+            THEN("The result is the element-wise sum of all of the matrices") {
+                Matrix<int, 2, 2> expected = {{14, 18,}, {22, 26,},};
+                CHECK(result == expected);
+            }
+        }
+        THEN("Evaluating a chain of element-wise operations into a Matrix of the wrong size throws an exception") {
+            CHECK_THROWS(Matrix<int, 3, 2>(a + b + c));
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef COM_SAXBOPHONE_GRYDE_TESTS_HELPERS_HPP
+#define COM_SAXBOPHONE_GRYDE_TESTS_HELPERS_HPP
+
+#include <atomic>
+#include <filesystem>
+#include <random>
+#include <string>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gryde/Matrix.hpp>
+
+// helpers shared between the unit tests
+namespace com::saxbophone::gryde::tests {
+// a path in the temporary directory, removed again at the end of the scope
+// the path is unique to each TemporaryFile, even between test runs at the same
+// time, and ends with name so that its extension is kept
+class TemporaryFile {
+public:
+    TemporaryFile(const std::string& name)
+      : _path(std::filesystem::temp_directory_path() / _unique_name(name))
+      {}
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+    ~TemporaryFile() {
+        std::filesystem::remove(_path);
+    }
+    const std::filesystem::path& path() const { return _path; }
+private:
+    // names are told apart by a random number chosen once per run and a count
+    // of the files made so far in it
+    static std::string _unique_name(const std::string& name) {
+        static const std::uint64_t run = [] {
+            std::random_device random;
+            return std::uint64_t{random()} << 32 | random();
+        }();
+        static std::atomic<std::uint64_t> count = 0;
+        return "gryde-test-" + std::to_string(run) + "-" + std::to_string(count++) + "-" + name;
+    }
+
+    std::filesystem::path _path;
+};
+
+// makes a dynamic Matrix with a predictable, non-uniform pattern of contents
+inline Matrix<long long> make_patterned(std::size_t m, std::size_t n, long long seed) {
+    Matrix<long long> matrix(m, n);
+    auto cells = matrix.contents();
+    for (std::size_t i = 0; i < cells.size(); i++) {
+        cells[i] = (static_cast<long long>(i) * seed) % 23 - 11;
+    }
+    return matrix;
+}
+} // namespace com::saxbophone::gryde::tests
+#endif // include guard
@@ -0,0 +1,250 @@
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/LU.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/SparseMatrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// fills any Matrix with a predictable, non-uniform pattern of small integers,
+// set cell by cell so it's the same whatever the layout
+template <typename X>
+static X make_patterned(X matrix, int seed) {
+    int value = seed;
+    for (std::size_t m = 0; m < matrix.row_count(); m++) {
+        for (std::size_t n = 0; n < matrix.col_count(); n++) {
+            value = (value * 7 + 3) % 19;
+            matrix(m, n) = static_cast<typename X::value_type>(value - 9);
+        }
+    }
+    return matrix;
+}
+
+SCENARIO("Column-major matrices store their cells column by column") {
+    GIVEN("A fixed and a dynamic column-major Matrix made from rows of cells") {
+        ColumnMajorMatrix<int, 2, 3> fixed = {{1, 2, 3,}, {4, 5, 6,},};
+        ColumnMajorMatrix<int> dynamic(2, 3, {{1, 2, 3,}, {4, 5, 6,},});
+        THEN("Their contents are in column order") {
+            std::vector<int> expected = {1, 4, 2, 5, 3, 6,};
+            CHECK(std::vector<int>(fixed.contents().begin(), fixed.contents().end()) == expected);
+            CHECK(std::vector<int>(dynamic.contents().begin(), dynamic.contents().end()) == expected);
+        }
+        THEN("Their cells are accessed by row and column as usual") {
+            CHECK(fixed(0, 2) == 3);
+            CHECK(fixed.at(1, 0) == 4);
+            CHECK(dynamic(0, 2) == 3);
+            CHECK(dynamic.at(1, 0) == 4);
+            CHECK(fixed.view()(1, 2) == 6);
+            CHECK(dynamic.view()(1, 2) == 6);
+        }
+        THEN("They can be made from cells in column order") {
+            std::vector<int> cells = {1, 4, 2, 5, 3, 6,};
+            CHECK(ColumnMajorMatrix<int, 2, 3>(cells) == fixed);
+            CHECK(ColumnMajorMatrix<int>(2, 3, cells) == dynamic);
+        }
+    }
+}
+
+SCENARIO("Converting and comparing matrices of different layouts") {
+    GIVEN("The same cells in a row-major and a column-major Matrix") {
+        Matrix<int, 3, 4> row = make_patterned(Matrix<int, 3, 4>(), 1);
+        ColumnMajorMatrix<int, 3, 4> column(row);
+        THEN("They have the same cells and compare equal") {
+            for (std::size_t m = 0; m < 3; m++) {
+                for (std::size_t n = 0; n < 4; n++) {
+                    CHECK(column(m, n) == row(m, n));
+                }
+            }
+            CHECK(column == row);
+            CHECK(row == column);
+            CHECK(Matrix<int, 3, 4>(column) == row);
+        }
+        THEN("Dynamic matrices converted from them compare equal in any combination") {
+            Matrix<int> dynamic_row(column);
+            ColumnMajorMatrix<int> dynamic_column(row);
+            CHECK(dynamic_row == row);
+            CHECK(dynamic_column == column);
+            CHECK(dynamic_row == dynamic_column);
+            CHECK(dynamic_column == row);
+            CHECK(row == dynamic_column);
+            CHECK(Matrix<int, 3, 4>(dynamic_column) == row);
+            CHECK(ColumnMajorMatrix<int, 3, 4>(dynamic_row) == column);
+        }
+        THEN("Changing a cell makes them compare unequal") {
+            column(2, 1) += 1;
+            CHECK_FALSE(column == row);
+            CHECK_FALSE(ColumnMajorMatrix<int>(column) == Matrix<int>(row));
+        }
+    }
+}
+
+SCENARIO("Element-wise operations on matrices of mixed layouts") {
+    GIVEN("Row-major and column-major matrices") {
+        Matrix<int> a = make_patterned(Matrix<int>(5, 7), 2);
+        Matrix<int> b = make_patterned(Matrix<int>(5, 7), 3);
+        ColumnMajorMatrix<int> a_column(a);
+        ColumnMajorMatrix<int> b_column(b);
+        Matrix<int> sum = a + b;
+        Matrix<int> difference = a - b;
+        THEN("Operations on them give the same cells in whatever layout they're stored") {
+            CHECK(Matrix<int>(a_column + b) == sum);
+            CHECK(Matrix<int>(a + b_column) == sum);
+            CHECK(ColumnMajorMatrix<int>(a_column + b_column) == sum);
+            CHECK(Matrix<int>(a_column + b_column) == sum);
+            CHECK(ColumnMajorMatrix<int>(a - b_column) == difference);
+            CHECK(ColumnMajorMatrix<int>(a_column * 3) == Matrix<int>(a * 3));
+            CHECK(Matrix<int>(hadamard_product(a_column, b)) == Matrix<int>(hadamard_product(a, b)));
+        }
+        THEN("Compound assignment from the other layout gives the same cells") {
+            a_column += b;
+            CHECK(a_column == sum);
+            a -= b_column;
+            CHECK(a == difference);
+        }
+        THEN("Expiring matrices of either layout can be reused for the result") {
+            CHECK(ColumnMajorMatrix<int>(a) + b == sum);
+            CHECK(a + ColumnMajorMatrix<int>(b) == sum);
+            CHECK(ColumnMajorMatrix<int>(a) - ColumnMajorMatrix<int>(b) == difference);
+        }
+    }
+}
+
+SCENARIO("Multiplying matrices of mixed layouts") {
+    GIVEN("Small fixed-size matrices") {
+        Matrix<double, 3, 4> a = make_patterned(Matrix<double, 3, 4>(), 4);
+        Matrix<double, 4, 2> b = make_patterned(Matrix<double, 4, 2>(), 5);
+        ColumnMajorMatrix<double, 3, 4> a_column(a);
+        ColumnMajorMatrix<double, 4, 2> b_column(b);
+        Matrix<double, 3, 2> product = a * b;
+        THEN("The product is the same for any combination of layouts") {
+            CHECK(a_column * b_column == product);
+            CHECK(a_column * b == product);
+            CHECK(a * b_column == product);
+        }
+        THEN("The product has the layout of the left operand") {
+            ColumnMajorMatrix<double, 3, 2> column_product = a_column * b;
+            Matrix<double, 3, 2> row_product = a * b_column;
+            CHECK(column_product == product);
+            CHECK(row_product == product);
+        }
+    }
+    GIVEN("Fixed-size matrices too large for closed-form multiplication") {
+        Matrix<double, 7, 5> a = make_patterned(Matrix<double, 7, 5>(), 6);
+        Matrix<double, 5, 6> b = make_patterned(Matrix<double, 5, 6>(), 7);
+        Matrix<double, 7, 6> product = a * b;
+        THEN("The product is the same for any combination of layouts") {
+            CHECK(ColumnMajorMatrix<double, 7, 5>(a) * ColumnMajorMatrix<double, 5, 6>(b) == product);
+            CHECK(ColumnMajorMatrix<double, 7, 5>(a) * b == product);
+            CHECK(a * ColumnMajorMatrix<double, 5, 6>(b) == product);
+        }
+    }
+    GIVEN("Large dynamic matrices") {
+        Matrix<double> a = make_patterned(Matrix<double>(150, 130), 8);
+        Matrix<double> b = make_patterned(Matrix<double>(130, 140), 9);
+        ColumnMajorMatrix<double> a_column(a);
+        ColumnMajorMatrix<double> b_column(b);
+        Matrix<double> product = a * b;
+        THEN("The product is the same for any combination of layouts") {
+            CHECK(a_column * b_column == product);
+            CHECK(a_column * b == product);
+            CHECK(a * b_column == product);
+            CHECK(multiply(execution::seq, a_column, b_column) == product);
+            CHECK(a_column.view() * b == product);
+        }
+        THEN("Fixed and dynamic matrices of mixed layouts can be multiplied") {
+            Matrix<double, 3, 150> c = make_patterned(Matrix<double, 3, 150>(), 10);
+            CHECK(c * a_column == c * a);
+            CHECK(ColumnMajorMatrix<double, 3, 150>(c) * a == c * a);
+            CHECK(b_column * Matrix<double, 140, 2>(make_patterned(Matrix<double, 140, 2>(), 11)) ==
+                b * make_patterned(Matrix<double, 140, 2>(), 11));
+        }
+    }
+}
+
+SCENARIO("Transposing column-major matrices") {
+    GIVEN("A fixed and a dynamic column-major Matrix") {
+        ColumnMajorMatrix<int, 3, 4> fixed(make_patterned(Matrix<int, 3, 4>(), 12));
+        ColumnMajorMatrix<int, 9, 6> larger(make_patterned(Matrix<int, 9, 6>(), 13));
+        ColumnMajorMatrix<int> dynamic(make_patterned(Matrix<int>(40, 30), 14));
+        THEN("Their transposes have the same layout and are the transposes of their cells") {
+            ColumnMajorMatrix<int, 4, 3> transposed = fixed.transpose();
+            CHECK(transposed == Matrix<int, 3, 4>(fixed).transpose());
+            CHECK(larger.transpose() == Matrix<int, 9, 6>(larger).transpose());
+            CHECK(dynamic.transpose() == Matrix<int>(dynamic).transpose());
+        }
+        THEN("Flipping their layout transposes them without reordering the cells") {
+            Matrix<int, 4, 3> flipped = fixed.flip_layout();
+            CHECK(flipped == fixed.transpose());
+            CHECK(std::vector<int>(flipped.contents().begin(), flipped.contents().end()) ==
+                std::vector<int>(fixed.contents().begin(), fixed.contents().end()));
+            CHECK(dynamic.flip_layout() == dynamic.transpose());
+            CHECK(dynamic.flip_layout().flip_layout() == dynamic);
+        }
+        THEN("Flipping the layout of an expiring Matrix takes its cells") {
+            ColumnMajorMatrix<int> expected = dynamic.transpose();
+            const int* cells = dynamic.contents().data();
+            Matrix<int> flipped = std::move(dynamic).flip_layout();
+            CHECK(flipped.contents().data() == cells);
+            CHECK(flipped == expected);
+            CHECK(dynamic.row_count() == 0);
+            CHECK(dynamic.col_count() == 0);
+        }
+    }
+}
+
+SCENARIO("Linear algebra on column-major matrices") {
+    GIVEN("A column-major Matrix and the same row-major one") {
+        Matrix<double, 6, 6> fixed = make_patterned(Matrix<double, 6, 6>(), 15);
+        Matrix<double> dynamic = make_patterned(Matrix<double>(70, 70), 16);
+        // the pattern repeats, so make them well away from singular
+        for (std::size_t k = 0; k < 70; k++) {
+            dynamic(k, k) += 100.0;
+            if (k < 6) {
+                fixed(k, k) += 100.0;
+            }
+        }
+        ColumnMajorMatrix<double, 6, 6> fixed_column(fixed);
+        ColumnMajorMatrix<double> dynamic_column(dynamic);
+        THEN("Their determinants and ranks are the same") {
+            CHECK(fixed_column.determinant() == Approx(fixed.determinant()));
+            CHECK(fixed_column.rank() == fixed.rank());
+            CHECK(dynamic_column.determinant() == Approx(dynamic.determinant()));
+            CHECK(dynamic_column.rank() == dynamic.rank());
+        }
+        THEN("Their inverses have the same cells") {
+            auto fixed_inverse = fixed.inverse();
+            auto fixed_column_inverse = fixed_column.inverse();
+            auto dynamic_inverse = dynamic.inverse();
+            auto dynamic_column_inverse = dynamic_column.inverse();
+            for (std::size_t m = 0; m < 6; m++) {
+                for (std::size_t n = 0; n < 6; n++) {
+                    CHECK(fixed_column_inverse(m, n) == Approx(fixed_inverse(m, n)));
+                }
+            }
+            for (std::size_t m = 0; m < 70; m++) {
+                for (std::size_t n = 0; n < 70; n++) {
+                    CHECK(dynamic_column_inverse(m, n) == Approx(dynamic_inverse(m, n)).margin(1e-9));
+                }
+            }
+        }
+        THEN("Factorising and solving with them gives the same as for the row-major one") {
+            LU lu(dynamic);
+            LU lu_column(dynamic_column);
+            CHECK(lu_column.upper() == lu.upper());
+            Matrix<double> b = make_patterned(Matrix<double>(70, 3), 17);
+            CHECK(lu_column.solve(ColumnMajorMatrix<double>(b)) == lu.solve(b));
+        }
+        THEN("Sparse matrices made from them have the same cells") {
+            CHECK(CsrMatrix<double>(dynamic_column) == CsrMatrix<double>(dynamic));
+            CHECK(CscMatrix<double>(fixed_column) == CscMatrix<double>(fixed));
+            CsrMatrix<double> sparse(dynamic);
+            CHECK(sparse * dynamic_column == sparse * dynamic);
+        }
+    }
+}
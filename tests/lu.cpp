@@ -0,0 +1,246 @@
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Execution.hpp>
+#include <gryde/LU.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/ThreadPool.hpp>
+#include <gryde/detail/BlockedLu.hpp>
+#include <gryde/detail/Lu.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// makes a square dynamic Matrix of pseudo-random contents, which needs
+// pivoting to factorise
+static Matrix<double> make_random(std::size_t n, std::uint32_t seed) {
+    Matrix<double> matrix(n, n);
+    for (auto& cell : matrix.contents()) {
+        seed = seed * 1664525u + 1013904223u;
+        cell = static_cast<double>(seed >> 8) / static_cast<double>(1u << 24) - 0.5;
+    }
+    return matrix;
+}
+
+// largest absolute difference between the cells of two matrices
+static double largest_difference(const Matrix<double>& a, const Matrix<double>& b) {
+    double largest = 0.0;
+    for (std::size_t i = 0; i < a.contents().size(); i++) {
+        largest = std::max(largest, detail::absolute(a.contents()[i] - b.contents()[i]));
+    }
+    return largest;
+}
+
+SCENARIO("Blocked LU factorisation") {
+    GIVEN("A large square Matrix with a size that doesn't divide evenly into blocks") {
+        auto n = GENERATE(as<std::size_t>(), 300, 517);
+        Matrix<double> matrix = make_random(n, 7);
+        AND_GIVEN("A ThreadPool, or none") {
+            ThreadPool pool(3);
+            auto parallel = GENERATE(false, true);
+            WHEN("It is factorised by blocks and without") {
+                Matrix<double> blocked = matrix;
+                Matrix<double> unblocked = matrix;
+                std::vector<std::size_t> blocked_pivots(n);
+                std::vector<std::size_t> unblocked_pivots(n);
+                int blocked_parity = detail::lu_factorise_blocked(
+                    blocked.contents().data(), n, blocked_pivots.data(), parallel ? &pool : nullptr
+                );
+                int unblocked_parity = detail::lu_factorise(
+                    unblocked.contents().data(), n, unblocked_pivots.data()
+                );
+                THEN("The same rows are chosen as pivots") {
+                    CHECK(blocked_pivots == unblocked_pivots);
+                    CHECK(blocked_parity == unblocked_parity);
+                }
+                THEN("The factors are the same, up to rounding") {
+                    CHECK(largest_difference(blocked, unblocked) < 1e-9);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Factorising a Matrix into an LU object") {
+    GIVEN("A small square Matrix") {
+        Matrix<double, 3, 3> matrix = {
+            {2.0, 1.0, 1.0,},
+            {4.0, -6.0, 0.0,},
+            {-2.0, 7.0, 2.0,},
+        };
+        WHEN("It is factorised") {
+            LU<double> lu(matrix);
+            THEN("L and U are triangular and their product is the permuted Matrix") {
+                Matrix<double> l = lu.lower();
+                Matrix<double> u = lu.upper();
+                std::vector<std::size_t> rows = lu.permutation();
+                Matrix<double> product = l * u;
+                for (std::size_t i = 0; i < 3; i++) {
+                    CHECK(l(i, i) == 1.0);
+                    for (std::size_t j = 0; j < 3; j++) {
+                        if (j > i) {
+                            CHECK(l(i, j) == 0.0);
+                        }
+                        if (j < i) {
+                            CHECK(u(i, j) == 0.0);
+                        }
+                        CHECK(product(i, j) == Approx(matrix(rows[i], j)));
+                    }
+                }
+            }
+            THEN("The determinant is the same as that of the Matrix") {
+                CHECK(lu.determinant() == Approx(matrix.determinant()));
+                CHECK_FALSE(lu.is_singular());
+            }
+        }
+    }
+    GIVEN("A singular Matrix") {
+        Matrix<double> matrix(3, 3, {{1.0, 2.0, 3.0,}, {2.0, 4.0, 6.0,}, {1.0, 0.0, 1.0,},});
+        THEN("Its factorisation is singular") {
+            LU<double> lu(matrix);
+            CHECK(lu.is_singular());
+            CHECK(lu.determinant() == 0.0);
+        }
+    }
+    GIVEN("A non-square Matrix") {
+        Matrix<double> matrix(3, 4);
+        THEN("Factorising it throws an exception") {
+            CHECK_THROWS_AS(LU<double>(matrix), std::runtime_error);
+        }
+    }
+    GIVEN("A large square Matrix and a ThreadPool") {
+        ThreadPool pool(3);
+        Matrix<double> matrix = make_random(300, 11);
+        WHEN("It is factorised in parallel") {
+            LU<double> lu(execution::par.on(pool), matrix);
+            THEN("The product of L and U is the permuted Matrix, up to rounding") {
+                Matrix<double> product = multiply(execution::par.on(pool), lu.lower(), lu.upper());
+                std::vector<std::size_t> rows = lu.permutation();
+                Matrix<double> permuted(300, 300);
+                for (std::size_t i = 0; i < 300; i++) {
+                    for (std::size_t j = 0; j < 300; j++) {
+                        permuted(i, j) = matrix(rows[i], j);
+                    }
+                }
+                CHECK(largest_difference(product, permuted) < 1e-9);
+            }
+            THEN("The determinant is the same as that of a sequential factorisation") {
+                LU<double> sequential(execution::seq, matrix);
+                CHECK(lu.determinant() == Approx(sequential.determinant()));
+                CHECK(matrix.determinant() == Approx(sequential.determinant()));
+            }
+        }
+    }
+}
+
+SCENARIO("Solving linear systems with an LU object") {
+    GIVEN("A small square Matrix and its factorisation") {
+        Matrix<double, 3, 3> matrix = {
+            {2.0, 1.0, 1.0,},
+            {4.0, -6.0, 0.0,},
+            {-2.0, 7.0, 2.0,},
+        };
+        LU lu(matrix);
+        THEN("Solving with a vector right-hand side gives the known solution") {
+            std::vector<double> b = {5.0, -2.0, 9.0,};
+            std::vector<double> x = lu.solve(b);
+            REQUIRE(x.size() == 3);
+            CHECK(x[0] == Approx(1.0));
+            CHECK(x[1] == Approx(1.0));
+            CHECK(x[2] == Approx(2.0));
+        }
+        THEN("Solving with a Matrix right-hand side solves for each of its columns") {
+            Matrix<double, 3, 2> b = {
+                {5.0, 3.0,},
+                {-2.0, -2.0,},
+                {9.0, 5.0,},
+            };
+            Matrix<double> x = lu.solve(b);
+            Matrix<double> product = Matrix<double>(matrix) * x;
+            for (std::size_t i = 0; i < 3; i++) {
+                for (std::size_t j = 0; j < 2; j++) {
+                    CHECK(product(i, j) == Approx(b(i, j)));
+                }
+            }
+        }
+        THEN("Its inverse is the same as that of the Matrix") {
+            Matrix<double> inverse = lu.inverse();
+            Matrix<double, 3, 3> expected = matrix.inverse();
+            for (std::size_t i = 0; i < 3; i++) {
+                for (std::size_t j = 0; j < 3; j++) {
+                    CHECK(inverse(i, j) == Approx(expected(i, j)));
+                }
+            }
+        }
+        THEN("Solving with right-hand sides of the wrong size throws an exception") {
+            CHECK_THROWS_AS(lu.solve(std::vector<double>(4)), std::runtime_error);
+            CHECK_THROWS_AS(lu.solve(Matrix<double>(2, 3)), std::runtime_error);
+        }
+    }
+    GIVEN("The factorisation of a singular Matrix") {
+        LU lu(Matrix<double>(3, 3, {{1.0, 2.0, 3.0,}, {2.0, 4.0, 6.0,}, {1.0, 0.0, 1.0,},}));
+        THEN("Solving with it or inverting it throws an exception") {
+            CHECK_THROWS_AS(lu.solve(std::vector<double>(3)), std::runtime_error);
+            CHECK_THROWS_AS(lu.solve(Matrix<double>(3, 1)), std::runtime_error);
+            CHECK_THROWS_AS(lu.inverse(), std::runtime_error);
+        }
+    }
+    GIVEN("A large square Matrix with many right-hand sides and a ThreadPool, or none") {
+        ThreadPool pool(3);
+        auto parallel = GENERATE(false, true);
+        Matrix<double> matrix = make_random(300, 13);
+        Matrix<double> b = make_random(300, 17);
+        LU<double> lu(matrix);
+        WHEN("It is solved for all of them at once") {
+            Matrix<double> x = parallel ? lu.solve(execution::par.on(pool), b) : lu.solve(execution::seq, b);
+            THEN("The Matrix multiplied by the solution is the right-hand sides, up to rounding") {
+                CHECK(largest_difference(matrix * x, b) < 1e-9);
+            }
+            THEN("Each column of the solution is the solution for that right-hand side") {
+                for (std::size_t j = 0; j < 300; j += 97) {
+                    std::vector<double> column(300);
+                    for (std::size_t i = 0; i < 300; i++) {
+                        column[i] = b(i, j);
+                    }
+                    std::vector<double> solution = lu.solve(column);
+                    for (std::size_t i = 0; i < 300; i++) {
+                        CHECK(solution[i] == Approx(x(i, j)).margin(1e-9));
+                    }
+                }
+            }
+        }
+        WHEN("It is solved for a right-hand side with no columns") {
+            Matrix<double> empty(300, 0);
+            Matrix<double> x = parallel ? lu.solve(execution::par.on(pool), empty) : lu.solve(execution::seq, empty);
+            THEN("The solution has no columns either") {
+                CHECK(x.row_count() == 300);
+                CHECK(x.col_count() == 0);
+            }
+        }
+        WHEN("It is inverted, through the factorisation and directly") {
+            Matrix<double> inverse = parallel ? lu.inverse(execution::par.on(pool)) : lu.inverse(execution::seq);
+            THEN("The inverse multiplied by the Matrix is the identity, up to rounding") {
+                Matrix<double> identity(300, 300);
+                for (std::size_t k = 0; k < 300; k++) {
+                    identity(k, k) = 1.0;
+                }
+                CHECK(largest_difference(inverse * matrix, identity) < 1e-9);
+                CHECK(largest_difference(matrix.inverse(), inverse) < 1e-9);
+            }
+        }
+    }
+    GIVEN("Dynamic-size matrices which are non-square or singular") {
+        Matrix<double> non_square(3, 4);
+        Matrix<double> singular(5, 5);
+        THEN("Inverting them throws an exception") {
+            CHECK_THROWS_AS(non_square.inverse(), std::runtime_error);
+            CHECK_THROWS_AS(singular.inverse(), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,199 @@
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+#include <gryde/MatrixBatch.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// makes fixed-size matrices with small integer contents, so that arithmetic
+// on them is exact even in floating-point
+template <typename T, std::size_t M, std::size_t N>
+static std::vector<Matrix<T, M, N>> make_matrices(std::size_t count, int seed) {
+    std::vector<Matrix<T, M, N>> matrices(count);
+    int value = seed;
+    for (auto& matrix : matrices) {
+        for (auto& cell : matrix.contents()) {
+            value = (value * 7 + 3) % 19;
+            cell = static_cast<T>(value - 9);
+        }
+        // keep them well away from singular
+        for (std::size_t i = 0; i < M and i < N; i++) {
+            matrix(i, i) += static_cast<T>(40);
+        }
+    }
+    return matrices;
+}
+
+SCENARIO("Storing matrices in a MatrixBatch") {
+    GIVEN("A MatrixBatch made from some matrices") {
+        std::vector<Matrix<int, 2, 3>> matrices = make_matrices<int, 2, 3>(5, 1);
+        MatrixBatch<int, 2, 3> batch(matrices);
+        THEN("It has the same number of matrices") {
+            CHECK(batch.size() == 5);
+            CHECK(batch.row_count() == 2);
+            CHECK(batch.col_count() == 3);
+        }
+        THEN("Each Matrix can be got back out of it") {
+            CHECK(batch.matrices() == matrices);
+            for (std::size_t i = 0; i < 5; i++) {
+                CHECK(batch.get(i) == matrices[i]);
+            }
+        }
+        THEN("The cells of each Matrix can be accessed") {
+            for (std::size_t i = 0; i < 5; i++) {
+                for (std::size_t m = 0; m < 2; m++) {
+                    for (std::size_t n = 0; n < 3; n++) {
+                        CHECK(batch(i, m, n) == matrices[i](m, n));
+                        CHECK(batch.at(i, m, n) == matrices[i](m, n));
+                    }
+                }
+            }
+        }
+        THEN("The same cell of every Matrix is stored together") {
+            auto cells = batch.cells(1, 2);
+            REQUIRE(cells.size() == 5);
+            for (std::size_t i = 0; i < 5; i++) {
+                CHECK(cells[i] == matrices[i](1, 2));
+                CHECK(&cells[i] == batch.data() + 5 * 5 + i);
+            }
+        }
+        THEN("Accessing cells out of bounds throws an exception") {
+            CHECK_THROWS_AS(batch.at(5, 0, 0), std::runtime_error);
+            CHECK_THROWS_AS(batch.at(0, 2, 0), std::runtime_error);
+            CHECK_THROWS_AS(batch.cells(0, 3), std::runtime_error);
+            CHECK_THROWS_AS(batch.get(5), std::runtime_error);
+        }
+        WHEN("A Matrix in it is replaced") {
+            Matrix<int, 2, 3> replacement = {{1, 2, 3,}, {4, 5, 6,},};
+            batch.set(3, replacement);
+            THEN("Only that Matrix is changed") {
+                CHECK(batch.get(3) == replacement);
+                CHECK(batch.get(2) == matrices[2]);
+                CHECK(batch.get(4) == matrices[4]);
+            }
+        }
+    }
+    GIVEN("A MatrixBatch of default-initialised matrices") {
+        MatrixBatch<double, 3, 3> batch(4);
+        THEN("They are all zero") {
+            CHECK(batch == MatrixBatch<double, 3, 3>(std::vector<Matrix<double, 3, 3>>(4)));
+        }
+    }
+}
+
+SCENARIO("Arithmetic on a MatrixBatch") {
+    GIVEN("Two batches of matrices, of a size that doesn't fill whole vectors") {
+        auto count = GENERATE(as<std::size_t>(), 0, 1, 7, 67);
+        auto x = make_matrices<float, 4, 4>(count, 1);
+        auto y = make_matrices<float, 4, 4>(count, 2);
+        MatrixBatch<float, 4, 4> a(x);
+        MatrixBatch<float, 4, 4> b(y);
+        THEN("Adding, subtracting and scaling them works on each Matrix") {
+            auto sum = (a + b).matrices();
+            auto difference = (a - b).matrices();
+            auto scaled = (2.0f * a).matrices();
+            for (std::size_t i = 0; i < count; i++) {
+                CHECK(sum[i] == x[i] + y[i]);
+                CHECK(difference[i] == x[i] - y[i]);
+                CHECK(scaled[i] == x[i] * 2.0f);
+            }
+        }
+        THEN("Multiplying them multiplies each pair of matrices") {
+            auto product = (a * b).matrices();
+            for (std::size_t i = 0; i < count; i++) {
+                CHECK(product[i] == x[i] * y[i]);
+            }
+        }
+        THEN("Transposing them transposes each Matrix") {
+            auto transposed = a.transpose().matrices();
+            for (std::size_t i = 0; i < count; i++) {
+                CHECK(transposed[i] == x[i].transpose());
+            }
+        }
+        THEN("Their determinants are those of each Matrix") {
+            auto determinants = a.determinants();
+            REQUIRE(determinants.size() == count);
+            for (std::size_t i = 0; i < count; i++) {
+                CHECK(determinants[i] == Approx(x[i].determinant()));
+            }
+        }
+        THEN("Each Matrix multiplied by its inverse is the identity") {
+            auto inverses = a.inverse().matrices();
+            for (std::size_t i = 0; i < count; i++) {
+                auto identity = x[i] * inverses[i];
+                for (std::size_t m = 0; m < 4; m++) {
+                    for (std::size_t n = 0; n < 4; n++) {
+                        CHECK(identity(m, n) == Approx(m == n ? 1.0 : 0.0).margin(1e-5));
+                    }
+                }
+            }
+        }
+    }
+    GIVEN("Batches of non-square and of large matrices") {
+        auto x = make_matrices<long long, 2, 3>(30, 3);
+        auto y = make_matrices<long long, 3, 5>(30, 4);
+        auto z = make_matrices<double, 6, 6>(30, 5);
+        MatrixBatch<long long, 2, 3> a(x);
+        MatrixBatch<long long, 3, 5> b(y);
+        MatrixBatch<double, 6, 6> c(z);
+        THEN("Multiplying them multiplies each pair of matrices") {
+            auto product = (a * b).matrices();
+            for (std::size_t i = 0; i < 30; i++) {
+                CHECK(product[i] == x[i] * y[i]);
+            }
+        }
+        THEN("Determinants and inverses of large matrices are found too") {
+            auto determinants = c.determinants();
+            auto inverses = c.inverse().matrices();
+            for (std::size_t i = 0; i < 30; i++) {
+                CHECK(determinants[i] == Approx(z[i].determinant()));
+                auto identity = z[i] * inverses[i];
+                for (std::size_t m = 0; m < 6; m++) {
+                    CHECK(identity(m, m) == Approx(1.0));
+                }
+            }
+        }
+    }
+    GIVEN("Two batches of different sizes") {
+        MatrixBatch<int, 2, 2> a(3);
+        MatrixBatch<int, 2, 2> b(4);
+        THEN("Arithmetic on them throws an exception") {
+            CHECK_THROWS_AS(a + b, std::runtime_error);
+            CHECK_THROWS_AS(a * b, std::runtime_error);
+        }
+    }
+    GIVEN("A batch of 4x4 integer matrices with small and large cells") {
+        auto matrices = make_matrices<int, 4, 4>(37, 2);
+        for (std::size_t i = 0; i < 3; i++) {
+            matrices[20](i, i) = 150;
+        }
+        MatrixBatch<int, 4, 4> batch(matrices);
+        THEN("Their determinants are exactly those of each Matrix") {
+            auto determinants = batch.determinants();
+            REQUIRE(determinants.size() == 37);
+            for (std::size_t i = 0; i < 37; i++) {
+                CHECK(determinants[i] == matrices[i].determinant());
+            }
+        }
+        WHEN("One of them has a determinant which overflows") {
+            batch.set(30, Matrix<int, 4, 4>{{50000, 0, 0, 0,}, {0, 50000, 0, 0,}, {0, 0, 50000, 0,}, {0, 0, 0, 1,},});
+            THEN("Taking their determinants throws an exception, as for the Matrix on its own") {
+                CHECK_THROWS_AS(batch.get(30).determinant(), std::overflow_error);
+                CHECK_THROWS_AS(batch.determinants(), std::overflow_error);
+            }
+        }
+    }
+    GIVEN("A batch with a singular Matrix in it") {
+        MatrixBatch<double, 3, 3> batch(make_matrices<double, 3, 3>(9, 1));
+        batch.set(4, Matrix<double, 3, 3>{});
+        THEN("Inverting it throws an exception") {
+            CHECK_THROWS_AS(batch.inverse(), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,160 @@
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+#include <gryde/MatrixFile.hpp>
+
+#include "helpers.hpp"
+
+
+using namespace com::saxbophone::gryde;
+using namespace com::saxbophone::gryde::tests;
+
+template <typename X>
+static X make_counting(X matrix) {
+    for (std::size_t m = 0; m < matrix.row_count(); m++) {
+        for (std::size_t n = 0; n < matrix.col_count(); n++) {
+            matrix(m, n) = static_cast<typename X::value_type>(m * 1000 + n);
+        }
+    }
+    return matrix;
+}
+
+SCENARIO("Saving and loading matrices") {
+    GIVEN("A dynamic, a fixed and a column-major Matrix saved to files") {
+        TemporaryFile dynamic_file("dynamic.gmat");
+        TemporaryFile fixed_file("fixed.gmat");
+        TemporaryFile column_file("column.gmat");
+        Matrix<double> dynamic = make_counting(Matrix<double>(37, 23));
+        Matrix<std::int16_t, 3, 5> fixed = make_counting(Matrix<std::int16_t, 3, 5>());
+        ColumnMajorMatrix<float> column = make_counting(ColumnMajorMatrix<float>(9, 4));
+        save_matrix(dynamic_file.path(), dynamic);
+        save_matrix(fixed_file.path(), fixed, 4096);
+        save_matrix(column_file.path(), column);
+        THEN("Loading them gives the same matrices") {
+            CHECK(load_matrix<double>(dynamic_file.path()) == dynamic);
+            CHECK(load_matrix<std::int16_t>(fixed_file.path()) == fixed);
+            CHECK(load_matrix<float, Layout::COLUMN_MAJOR>(column_file.path()) == column);
+        }
+        THEN("Loading them with the other layout gives the same cells") {
+            ColumnMajorMatrix<double> loaded = load_matrix<double, Layout::COLUMN_MAJOR>(dynamic_file.path());
+            CHECK(loaded == dynamic);
+            CHECK(load_matrix<float>(column_file.path()) == column);
+        }
+        THEN("The cells start at the given alignment") {
+            CHECK(std::filesystem::file_size(dynamic_file.path()) == 64 + 37 * 23 * sizeof(double));
+            CHECK(std::filesystem::file_size(fixed_file.path()) == 4096 + 3 * 5 * sizeof(std::int16_t));
+        }
+        THEN("Loading them with another element type throws an exception") {
+            CHECK_THROWS_AS(load_matrix<float>(dynamic_file.path()), std::runtime_error);
+            CHECK_THROWS_AS(load_matrix<std::uint16_t>(fixed_file.path()), std::runtime_error);
+        }
+    }
+    GIVEN("An empty Matrix saved to a file") {
+        TemporaryFile file("empty.gmat");
+        save_matrix(file.path(), Matrix<int>(0, 4));
+        THEN("Loading it gives an empty Matrix") {
+            Matrix<int> loaded = load_matrix<int>(file.path());
+            CHECK(loaded.row_count() == 0);
+            CHECK(loaded.col_count() == 4);
+        }
+    }
+    THEN("Saving with an alignment which isn't a power of two throws an exception") {
+        TemporaryFile file("unaligned.gmat");
+        CHECK_THROWS_AS(save_matrix(file.path(), Matrix<int>(2, 2), 48), std::runtime_error);
+    }
+}
+
+SCENARIO("Mapping Matrix files") {
+    GIVEN("A Matrix saved to a file") {
+        TemporaryFile file("mapped.gmat");
+        Matrix<double> matrix = make_counting(Matrix<double>(120, 70));
+        save_matrix(file.path(), matrix);
+        WHEN("It is mapped read-only") {
+            MappedMatrix<const double> mapped(file.path());
+            THEN("It has the same dimensions and cells") {
+                CHECK(mapped.dimensions() == std::pair<std::size_t, std::size_t>(120, 70));
+                CHECK(mapped(119, 69) == matrix(119, 69));
+                CHECK(mapped.at(3, 4) == 3004.0);
+                CHECK(Matrix<double>(mapped.view()) == matrix);
+            }
+            THEN("Its cells are aligned") {
+                auto address = reinterpret_cast<std::uintptr_t>(mapped.contents().data());
+                CHECK(address % MATRIX_FILE_ALIGNMENT == 0);
+            }
+            THEN("It can be used in arithmetic like any other Matrix") {
+                CHECK(Matrix<double>(mapped.view() + matrix) == Matrix<double>(matrix * 2.0));
+                CHECK(multiply(execution::seq, mapped, matrix.transpose()) == matrix * matrix.transpose());
+            }
+            THEN("Its cells can only be read") {
+                STATIC_REQUIRE(std::is_same_v<decltype(mapped.contents()), std::span<const double>>);
+                STATIC_REQUIRE(std::is_same_v<decltype(mapped.at(0, 0)), const double&>);
+                STATIC_REQUIRE(std::is_same_v<decltype(mapped(0, 0)), const double&>);
+                STATIC_REQUIRE(MatrixLike<MappedMatrix<const double>>);
+                STATIC_REQUIRE(not WritableMatrixLike<MappedMatrix<const double>>);
+                STATIC_REQUIRE(WritableMatrixLike<MappedMatrix<double>>);
+            }
+            THEN("It can be moved") {
+                MappedMatrix<const double> moved = std::move(mapped);
+                CHECK(moved(5, 6) == 5006.0);
+            }
+        }
+        WHEN("It is mapped copy-on-write and changed") {
+            MappedMatrix<double> mapped(file.path());
+            mapped(1, 2) = -1.0;
+            mapped.at(3, 4) = -2.0;
+            THEN("The mapping has the changes") {
+                CHECK(mapped(1, 2) == -1.0);
+                CHECK(mapped.contents()[3 * 70 + 4] == -2.0);
+            }
+            THEN("The file doesn't") {
+                CHECK(load_matrix<double>(file.path()) == matrix);
+                MappedMatrix<const double> fresh(file.path());
+                CHECK(fresh(1, 2) == 1002.0);
+            }
+        }
+        THEN("Mapping it with another element type or layout throws an exception") {
+            CHECK_THROWS_AS(MappedMatrix<const float>(file.path()), std::runtime_error);
+            CHECK_THROWS_AS((MappedMatrix<const double, Layout::COLUMN_MAJOR>(file.path())), std::runtime_error);
+        }
+    }
+    GIVEN("A column-major Matrix saved to a file") {
+        TemporaryFile file("mapped-column.gmat");
+        ColumnMajorMatrix<int> matrix = make_counting(ColumnMajorMatrix<int>(6, 8));
+        save_matrix(file.path(), matrix);
+        THEN("It can be mapped as column-major") {
+            MappedMatrix<const int, Layout::COLUMN_MAJOR> mapped(file.path());
+            CHECK(mapped(5, 7) == 5007);
+            CHECK(ColumnMajorMatrix<int>(mapped.view()) == matrix);
+        }
+    }
+    GIVEN("Files which aren't valid Matrix files") {
+        TemporaryFile file("invalid.gmat");
+        TemporaryFile missing("missing.gmat");
+        THEN("Mapping or loading a file which isn't a Matrix file throws an exception") {
+            std::ofstream(file.path(), std::ios::binary) << std::string(100, 'x');
+            CHECK_THROWS_AS(MappedMatrix<const int>(file.path()), std::runtime_error);
+            CHECK_THROWS_AS(load_matrix<int>(file.path()), std::runtime_error);
+        }
+        THEN("Mapping or loading a truncated Matrix file throws an exception") {
+            save_matrix(file.path(), Matrix<int>(10, 10));
+            std::filesystem::resize_file(file.path(), 64 + 99 * sizeof(int));
+            CHECK_THROWS_AS(MappedMatrix<const int>(file.path()), std::runtime_error);
+            CHECK_THROWS_AS(load_matrix<int>(file.path()), std::runtime_error);
+        }
+        THEN("Mapping or loading a file which doesn't exist throws an exception") {
+            CHECK_THROWS_AS(MappedMatrix<const int>(missing.path()), std::runtime_error);
+            CHECK_THROWS_AS(load_matrix<int>(missing.path()), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,175 @@
+#include <vector>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// naive reference multiplication of row-major cells, used to verify results
+static std::vector<long long> reference_multiply(
+    std::size_t m, std::size_t n, std::size_t p,
+    std::span<const long long> a,
+    std::span<const long long> b
+) {
+    std::vector<long long> c(m * p);
+    for (std::size_t i = 0; i < m; i++) {
+        for (std::size_t j = 0; j < p; j++) {
+            for (std::size_t k = 0; k < n; k++) {
+                c[i * p + j] += a[i * n + k] * b[k * p + j];
+            }
+        }
+    }
+    return c;
+}
+
+// makes a dynamic Matrix with a predictable, non-uniform pattern of contents
+static Matrix<long long> make_patterned(std::size_t m, std::size_t n, long long seed) {
+    Matrix<long long> matrix(m, n);
+    auto cells = matrix.contents();
+    for (std::size_t i = 0; i < cells.size(); i++) {
+        cells[i] = (static_cast<long long>(i) * seed) % 19 - 9;
+    }
+    return matrix;
+}
+
+SCENARIO("Multiplying fixed-size Matrix by fixed-size Matrix") {
+    GIVEN("A fixed-size Matrix of dimensions 2x3 with some contents") {
+        Matrix<int, 2, 3> a = {
+            {1, 2, 3,},
+            {4, 5, 6,},
+        };
+        AND_GIVEN("A fixed-size Matrix of dimensions 3x2 with some contents") {
+            Matrix<int, 3, 2> b = {
+                {7, 8,},
+                {9, 10,},
+                {11, 12,},
+            };
+            WHEN("The two matrices are multiplied together") {
+                Matrix<int, 2, 2> c = a * b;
+                THEN("The result is the matrix product of the two matrices") {
+                    Matrix<int, 2, 2> expected = {
+                        {58, 64,},
+                        {139, 154,},
+                    };
+                    CHECK(c == expected);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Multiplying fixed-size Matrix by dynamic-size Matrix") {
+    GIVEN("A fixed-size Matrix of dimensions 2x3 with some contents") {
+        Matrix<int, 2, 3> a = {
+            {1, 2, 3,},
+            {4, 5, 6,},
+        };
+        AND_GIVEN("A dynamic-size Matrix of dimensions 3x2 with some contents") {
+            Matrix<int> b(
+                3, 2,
+                {
+                    {7, 8,},
+                    {9, 10,},
+                    {11, 12,},
+                }
+            );
+            WHEN("The two matrices are multiplied together") {
+                Matrix<int> c = a * b;
+                THEN("The result is the matrix product of the two matrices, as a dynamic-size Matrix") {
+                    Matrix<int> expected(
+                        2, 2,
+                        {
+                            {58, 64,},
+                            {139, 154,},
+                        }
+                    );
+                    CHECK(c == expected);
+                }
+            }
+        }
+        AND_GIVEN("A dynamic-size Matrix with incompatible dimensions") {
+            Matrix<int> b(2, 3);
+            THEN("Attempting to multiply them throws an exception") {
+                CHECK_THROWS(a * b);
+            }
+        }
+    }
+}
+
+SCENARIO("Multiplying dynamic-size Matrix by fixed-size Matrix") {
+    GIVEN("A dynamic-size Matrix of dimensions 2x3 with some contents") {
+        Matrix<int> a(
+            2, 3,
+            {
+                {1, 2, 3,},
+                {4, 5, 6,},
+            }
+        );
+        AND_GIVEN("A fixed-size Matrix of dimensions 3x2 with some contents") {
+            Matrix<int, 3, 2> b = {
+                {7, 8,},
+                {9, 10,},
+                {11, 12,},
+            };
+            WHEN("The two matrices are multiplied together") {
+                Matrix<int> c = a * b;
+                THEN("The result is the matrix product of the two matrices, as a dynamic-size Matrix") {
+                    Matrix<int> expected(
+                        2, 2,
+                        {
+                            {58, 64,},
+                            {139, 154,},
+                        }
+                    );
+                    CHECK(c == expected);
+                }
+            }
+        }
+        AND_GIVEN("A fixed-size Matrix with incompatible dimensions") {
+            Matrix<int, 2, 3> b;
+            THEN("Attempting to multiply them throws an exception") {
+                CHECK_THROWS(a * b);
+            }
+        }
+    }
+}
+
+SCENARIO("Multiplying dynamic-size Matrix by dynamic-size Matrix") {
+    GIVEN("Two zero-sized dynamic-size matrices") {
+        Matrix<int> a(0, 0);
+        Matrix<int> b(0, 0);
+        THEN("The two matrices can be multiplied together, giving another empty Matrix") {
+            Matrix<int> c = a * b;
+            CHECK(c.row_count() == 0);
+            CHECK(c.col_count() == 0);
+        }
+    }
+    GIVEN("Two dynamic-size matrices with incompatible dimensions") {
+        Matrix<int> a(3, 4);
+        Matrix<int> b(3, 4);
+        THEN("Attempting to multiply them throws an exception") {
+            CHECK_THROWS(a * b);
+        }
+    }
+    GIVEN("Two large dynamic-size matrices with dimensions that don't divide evenly into blocks") {
+        auto m = GENERATE(as<std::size_t>(), 1, 5, 150);
+        auto n = GENERATE(as<std::size_t>(), 3, 300);
+        auto p = GENERATE(as<std::size_t>(), 1, 37);
+        Matrix<long long> a = make_patterned(m, n, 7);
+        Matrix<long long> b = make_patterned(n, p, 11);
+        WHEN("The two matrices are multiplied together") {
+            Matrix<long long> c = a * b;
+            THEN("The result is the matrix product of the two matrices") {
+                REQUIRE(c.row_count() == m);
+                REQUIRE(c.col_count() == p);
+                auto cc = c.contents();
+                std::vector<long long> contents(cc.begin(), cc.end());
+                CHECK(contents == reference_multiply(m, n, p, a.contents(), b.contents()));
+            }
+        }
+    }
+}
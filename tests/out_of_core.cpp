@@ -0,0 +1,71 @@
+#include <stdexcept>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Execution.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/MatrixFile.hpp>
+#include <gryde/OutOfCore.hpp>
+
+#include "helpers.hpp"
+
+
+using namespace com::saxbophone::gryde;
+using namespace com::saxbophone::gryde::tests;
+
+SCENARIO("Multiplying matrices in Matrix files tile by tile") {
+    GIVEN("Two compatible matrices saved to files") {
+        TemporaryFile lhs_file("lhs.gmat");
+        TemporaryFile rhs_file("rhs.gmat");
+        TemporaryFile product_file("product.gmat");
+        Matrix<long long> lhs = make_patterned(37, 53, 7);
+        Matrix<long long> rhs = make_patterned(53, 29, 5);
+        save_matrix(lhs_file.path(), lhs);
+        save_matrix(rhs_file.path(), rhs);
+        WHEN("They're multiplied out-of-core with tiles of any size") {
+            // ragged tiles, tiles spanning whole rows and a single tile
+            auto tile_size = GENERATE(as<std::size_t>(), 1, 8, 29, 100);
+            multiply_files<long long>(execution::seq, lhs_file.path(), rhs_file.path(), product_file.path(), tile_size);
+            THEN("The product file holds their product") {
+                CHECK(load_matrix<long long>(product_file.path()) == lhs * rhs);
+            }
+        }
+        WHEN("They're multiplied out-of-core in parallel") {
+            multiply_files<long long>(execution::par, lhs_file.path(), rhs_file.path(), product_file.path(), 16);
+            THEN("The product file holds their product") {
+                CHECK(load_matrix<long long>(product_file.path()) == lhs * rhs);
+            }
+        }
+        THEN("Multiplying them the other way round throws an exception") {
+            CHECK_THROWS_AS(
+                multiply_files<long long>(execution::seq, rhs_file.path(), lhs_file.path(), product_file.path()),
+                std::runtime_error
+            );
+        }
+        THEN("Multiplying them as another element type throws an exception") {
+            CHECK_THROWS_AS(
+                multiply_files<double>(execution::seq, lhs_file.path(), rhs_file.path(), product_file.path()),
+                std::runtime_error
+            );
+        }
+        THEN("Multiplying them with tiles of size zero throws an exception") {
+            CHECK_THROWS_AS(
+                multiply_files<long long>(execution::seq, lhs_file.path(), rhs_file.path(), product_file.path(), 0),
+                std::runtime_error
+            );
+        }
+    }
+    GIVEN("Two matrices with an inner dimension of zero saved to files") {
+        TemporaryFile lhs_file("empty-lhs.gmat");
+        TemporaryFile rhs_file("empty-rhs.gmat");
+        TemporaryFile product_file("empty-product.gmat");
+        save_matrix(lhs_file.path(), Matrix<int>(3, 0));
+        save_matrix(rhs_file.path(), Matrix<int>(0, 4));
+        THEN("Their product is a file of zeroes") {
+            multiply_files<int>(execution::seq, lhs_file.path(), rhs_file.path(), product_file.path(), 2);
+            CHECK(load_matrix<int>(product_file.path()) == Matrix<int>(3, 4));
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Execution.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/ThreadPool.hpp>
+
+#include "helpers.hpp"
+
+
+using namespace com::saxbophone::gryde;
+using namespace com::saxbophone::gryde::tests;
+
+SCENARIO("Running parallel loops on a ThreadPool") {
+    GIVEN("A ThreadPool with some number of workers") {
+        auto workers = GENERATE(as<std::size_t>(), 0, 1, 3);
+        ThreadPool pool(workers);
+        REQUIRE(pool.worker_count() == workers);
+        THEN("parallel_for() runs every iteration exactly once") {
+            std::vector<std::atomic<int>> runs(1000);
+            pool.parallel_for(runs.size(), [&](std::size_t i) { runs[i]++; });
+            for (auto& count : runs) {
+                CHECK(count.load() == 1);
+            }
+        }
+        THEN("parallel_for() can be nested") {
+            std::atomic<std::size_t> total = 0;
+            pool.parallel_for(8, [&](std::size_t i) {
+                pool.parallel_for(8, [&](std::size_t j) { total += i * 8 + j; });
+            });
+            CHECK(total.load() == 63 * 64 / 2);
+        }
+        THEN("An exception thrown by an iteration is rethrown by parallel_for()") {
+            std::atomic<int> runs = 0;
+            CHECK_THROWS_AS(
+                pool.parallel_for(100, [&](std::size_t i) {
+                    runs++;
+                    if (i == 42) {
+                        throw std::runtime_error("failed");
+                    }
+                }),
+                std::runtime_error
+            );
+            CHECK(runs.load() == 100);
+        }
+    }
+}
+
+SCENARIO("Multiplying matrices in parallel") {
+    GIVEN("A ThreadPool and two large matrices with dimensions that don't divide evenly into tiles") {
+        ThreadPool pool(3);
+        auto m = GENERATE(as<std::size_t>(), 1, 300);
+        auto p = GENERATE(as<std::size_t>(), 7, 517);
+        Matrix<long long> a = make_patterned(m, 200, 7);
+        Matrix<long long> b = make_patterned(200, p, 11);
+        Matrix<long long> expected = multiply(execution::seq, a, b);
+        THEN("Multiplying them in parallel gives the same result as multiplying them sequentially") {
+            CHECK(multiply(execution::par.on(pool), a, b) == expected);
+        }
+        THEN("Views can be multiplied in parallel too") {
+            Matrix<long long> bt = b.transpose();
+            CHECK(multiply(execution::par.on(pool), a.view(), bt.view().transpose()) == expected);
+        }
+        WHEN("The pool is made the default for multiplication") {
+            execution::set_default_policy(execution::par.on(pool));
+            Matrix<long long> c = a * b;
+            execution::set_default_policy(execution::seq);
+            THEN("operator* gives the same result") {
+                CHECK(c == expected);
+            }
+        }
+    }
+    GIVEN("Two matrices with incompatible dimensions") {
+        Matrix<int> a(3, 4);
+        THEN("Multiplying them in parallel throws an exception") {
+            CHECK_THROWS(multiply(execution::par, a, a));
+        }
+    }
+}
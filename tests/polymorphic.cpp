@@ -0,0 +1,48 @@
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+TEST_CASE("Matrix types have no virtual dispatch overhead") {
+    STATIC_REQUIRE_FALSE(std::is_polymorphic_v<Matrix<int, 3, 3>>);
+    STATIC_REQUIRE_FALSE(std::is_polymorphic_v<Matrix<int>>);
+    STATIC_REQUIRE(sizeof(Matrix<float, 4, 4>) == sizeof(float) * 16);
+    STATIC_REQUIRE(MatrixLike<Matrix<int, 3, 3>>);
+    STATIC_REQUIRE(MatrixLike<Matrix<int>>);
+}
+
+SCENARIO("Storing different kinds of Matrix together through type erasure") {
+    GIVEN("A container of type-erased matrices holding both fixed-size and dynamic-size matrices") {
+        std::vector<std::unique_ptr<MatrixBase<int>>> matrices;
+        matrices.push_back(
+            std::make_unique<PolymorphicMatrix<Matrix<int, 2, 3>>>(
+                Matrix<int, 2, 3>{{1, 2, 3,}, {4, 5, 6,},}
+            )
+        );
+        matrices.push_back(
+            std::make_unique<PolymorphicMatrix<Matrix<int>>>(
+                Matrix<int>(3, 1, {{7,}, {8,}, {9,},})
+            )
+        );
+        THEN("Each Matrix can be inspected through the common interface") {
+            CHECK(matrices[0]->dimensions() == std::pair<std::size_t, std::size_t>{2, 3});
+            CHECK((*matrices[0])(1, 2) == 6);
+            CHECK(matrices[1]->dimensions() == std::pair<std::size_t, std::size_t>{3, 1});
+            CHECK((*matrices[1])(2, 0) == 9);
+            CHECK(MatrixBase<int>::dimensions_compatible(*matrices[0], *matrices[1]));
+        }
+        WHEN("A Matrix is modified through the common interface") {
+            (*matrices[1])(0, 0) = 70;
+            THEN("The wrapped Matrix is modified") {
+                auto& wrapped = static_cast<PolymorphicMatrix<Matrix<int>>&>(*matrices[1]);
+                CHECK(wrapped.matrix()(0, 0) == 70);
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+SCENARIO("Calculating rank of fixed-size Matrix") {
+    GIVEN("An empty fixed-size Matrix") {
+        Matrix<int, 0, 0> empty;
+        THEN("Matrix.rank() is calculated as 0") {
+            CHECK(empty.rank() == 0);
+        }
+    }
+    GIVEN("A fixed-size Matrix of all zeroes") {
+        Matrix<double, 3, 4> zero;
+        THEN("Matrix.rank() is calculated as 0") {
+            CHECK(zero.rank() == 0);
+        }
+    }
+    GIVEN("A non-square fixed-size Matrix of integers with a linearly dependent row") {
+        Matrix<int, 3, 4> matrix = {
+            {1, 2, 3, 4,},
+            {0, 0, 1, 7,},
+            {2, 4, 7, 15,},
+        };
+        THEN("Matrix.rank() returns the number of linearly independent rows") {
+            CHECK(matrix.rank() == 2);
+        }
+    }
+    GIVEN("A non-square fixed-size Matrix of floating-point values with full rank") {
+        Matrix<double, 4, 2> matrix = {
+            {0.0, 1.5,},
+            {2.0, 1.0,},
+            {4.0, 2.0,},
+            {6.0, 3.0,},
+        };
+        THEN("Matrix.rank() returns the smaller of its dimensions") {
+            CHECK(matrix.rank() == 2);
+        }
+    }
+}
+
+SCENARIO("Calculating rank of dynamic-size Matrix") {
+    GIVEN("A non-square dynamic-size Matrix of integers with a linearly dependent row") {
+        Matrix<long long> matrix(
+            3, 4,
+            {
+                {1, 2, 3, 4,},
+                {0, 0, 1, 7,},
+                {2, 4, 7, 15,},
+            }
+        );
+        THEN("Matrix.rank() returns the number of linearly independent rows") {
+            CHECK(matrix.rank() == 2);
+        }
+    }
+    GIVEN("A dynamic-size Matrix of floating-point values which is singular only up to rounding") {
+        Matrix<double> matrix(
+            3, 3,
+            {
+                {0.1, 0.2, 0.3,},
+                {0.4, 0.5, 0.6,},
+                {0.7, 0.8, 0.9,},
+            }
+        );
+        THEN("Matrix.rank() treats the rounding errors as zero") {
+            CHECK(matrix.rank() == 2);
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/detail/Simd.hpp>
+
+
+using namespace com::saxbophone::gryde::detail::simd;
+
+// every instruction set that the CPU running the tests supports
+static std::vector<Isa> supported_isas() {
+    std::vector<Isa> isas;
+    for (Isa isa : {Isa::SCALAR, Isa::SSE2, Isa::AVX2, Isa::AVX512}) {
+        if (isa <= active_isa()) {
+            isas.push_back(isa);
+        }
+    }
+    return isas;
+}
+
+TEMPLATE_TEST_CASE("Vectorised element-wise kernels agree with scalar arithmetic", "", float, double, std::int32_t, std::int64_t) {
+    // sizes chosen to exercise whole vectors, ragged ends and both together
+    auto count = GENERATE(as<std::size_t>(), 0, 1, 7, 16, 67, 1000);
+    std::vector<TestType> a(count);
+    std::vector<TestType> b(count);
+    for (std::size_t i = 0; i < count; i++) {
+        a[i] = static_cast<TestType>(i % 13) - 6;
+        b[i] = static_cast<TestType>(i % 7) + 1;
+    }
+    for (Isa isa : supported_isas()) {
+        CAPTURE(static_cast<int>(isa));
+        std::vector<TestType> out(count);
+        transform<Operation::ADD>(isa, a.data(), b.data(), TestType{}, out.data(), count);
+        for (std::size_t i = 0; i < count; i++) {
+            CHECK(out[i] == a[i] + b[i]);
+        }
+        transform<Operation::SUBTRACT>(isa, a.data(), b.data(), TestType{}, out.data(), count);
+        for (std::size_t i = 0; i < count; i++) {
+            CHECK(out[i] == a[i] - b[i]);
+        }
+        transform<Operation::MULTIPLY>(isa, a.data(), b.data(), TestType{}, out.data(), count);
+        for (std::size_t i = 0; i < count; i++) {
+            CHECK(out[i] == a[i] * b[i]);
+        }
+        transform<Operation::SCALE>(isa, a.data(), static_cast<const TestType*>(nullptr), TestType{3}, out.data(), count);
+        for (std::size_t i = 0; i < count; i++) {
+            CHECK(out[i] == a[i] * 3);
+        }
+        CHECK(equal(isa, a.data(), a.data(), count));
+        if (count > 0) {
+            // a difference anywhere must be found, including in the last cell
+            std::vector<TestType> c = a;
+            c[count - 1] += 1;
+            CHECK_FALSE(equal(isa, a.data(), c.data(), count));
+        }
+    }
+}
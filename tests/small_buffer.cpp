@@ -0,0 +1,156 @@
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// makes all pmr allocations fail while in scope
+class NoAllocations {
+public:
+    NoAllocations() : _previous(std::pmr::set_default_resource(std::pmr::null_memory_resource())) {}
+    ~NoAllocations() { std::pmr::set_default_resource(_previous); }
+private:
+    std::pmr::memory_resource* _previous;
+};
+
+// memory resource which counts the allocations made through it which haven't
+// been freed yet
+class LiveResource : public std::pmr::memory_resource {
+public:
+    std::size_t live = 0;
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        live++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        live--;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+SCENARIO("Small dynamic-size matrices don't allocate") {
+    GIVEN("Allocation is impossible") {
+        NoAllocations no_allocations;
+        THEN("Small dynamic-size matrices can still be made and used") {
+            pmr::Matrix<double> a(4, 4);
+            for (std::size_t i = 0; i < 4; i++) {
+                a(i, i) = 2.0;
+                a(i, 3 - i) += 1.0;
+            }
+            pmr::Matrix<double> b = a;
+            pmr::Matrix<double> c = a + b * 2.0;
+            pmr::Matrix<double> d = c * a;
+            pmr::Matrix<double> e = d.transpose().remove_row(1);
+            CHECK(c(0, 0) == 6.0);
+            CHECK(d(1, 1) == 15.0);
+            CHECK(e.row_count() == 3);
+            CHECK(e.col_count() == 4);
+        }
+        THEN("Making a large dynamic-size Matrix fails to allocate") {
+            CHECK_THROWS_AS(pmr::Matrix<double>(5, 5), std::bad_alloc);
+        }
+    }
+}
+
+SCENARIO("Copying and moving dynamic-size matrices stored inline or allocated") {
+    GIVEN("A dynamic-size Matrix of some size") {
+        auto size = GENERATE(as<std::size_t>(), 1, 4, 5, 20);
+        Matrix<int> matrix(size, size);
+        auto cells = matrix.contents();
+        for (std::size_t i = 0; i < cells.size(); i++) {
+            cells[i] = static_cast<int>(i);
+        }
+        WHEN("It is copied") {
+            Matrix<int> copy = matrix;
+            THEN("The copy has equal cells in different storage") {
+                CHECK(copy == matrix);
+                CHECK(copy.contents().data() != matrix.contents().data());
+            }
+        }
+        WHEN("It is moved") {
+            Matrix<int> expected = matrix;
+            Matrix<int> moved = std::move(matrix);
+            THEN("The Matrix moved into has the cells") {
+                CHECK(moved == expected);
+            }
+        }
+        WHEN("It is assigned over a Matrix of another size") {
+            Matrix<int> other(3, 7);
+            other = matrix;
+            THEN("The Matrix assigned to has the cells") {
+                CHECK(other == matrix);
+            }
+        }
+    }
+}
+
+SCENARIO("Dynamic-size matrices stored inline are aligned and don't keep allocated storage") {
+    GIVEN("A small dynamic-size Matrix") {
+        Matrix<char> bytes(3, 3);
+        THEN("Its cells start on a cache line boundary") {
+            CHECK(reinterpret_cast<std::uintptr_t>(bytes.contents().data()) % CACHE_LINE_SIZE == 0);
+        }
+    }
+    GIVEN("A large dynamic-size Matrix with cells from a memory resource") {
+        LiveResource resource;
+        pmr::Matrix<int> matrix(5, 5, &resource);
+        REQUIRE(resource.live == 1);
+        WHEN("A small Matrix is moved over it") {
+            matrix = pmr::Matrix<int>(2, 2, {{1, 2,}, {3, 4,},});
+            THEN("Its allocated storage is freed") {
+                CHECK(resource.live == 0);
+                CHECK(matrix == pmr::Matrix<int>(2, 2, {{1, 2,}, {3, 4,},}));
+            }
+        }
+        WHEN("A small Matrix is copied over it") {
+            const pmr::Matrix<int> small(2, 2, {{1, 2,}, {3, 4,},});
+            pmr::Matrix<int> copy = small;
+            matrix = copy;
+            THEN("Its allocated storage is freed") {
+                CHECK(resource.live == 0);
+                CHECK(matrix == small);
+            }
+        }
+    }
+}
+
+SCENARIO("Determinant and rank of small dynamic-size matrices") {
+    GIVEN("A 4x4 dynamic-size Matrix") {
+        Matrix<double> floating(
+            4, 4,
+            {
+                {2, 1, 0, 0,},
+                {1, 2, 1, 0,},
+                {0, 1, 2, 1,},
+                {0, 0, 1, 2,},
+            }
+        );
+        Matrix<long long> integer(
+            4, 4,
+            {
+                {2, 1, 0, 0,},
+                {1, 2, 1, 0,},
+                {0, 1, 2, 1,},
+                {0, 0, 1, 2,},
+            }
+        );
+        THEN("Its determinant and rank are correct") {
+            CHECK(floating.determinant() == Approx(5.0));
+            CHECK(integer.determinant() == 5);
+            CHECK(floating.rank() == 4);
+            CHECK(integer.rank() == 4);
+        }
+    }
+}
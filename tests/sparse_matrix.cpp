@@ -0,0 +1,217 @@
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Execution.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/SparseMatrix.hpp>
+#include <gryde/ThreadPool.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// makes a dense Matrix of small integers, mostly zero, so that arithmetic on
+// it is exact even in floating-point
+static Matrix<double> make_sparse(std::size_t m, std::size_t n, std::uint32_t seed, std::uint32_t one_in) {
+    Matrix<double> matrix(m, n);
+    for (auto& cell : matrix.contents()) {
+        seed = seed * 1664525u + 1013904223u;
+        if ((seed >> 8) % one_in == 0) {
+            cell = static_cast<double>((seed >> 16) % 19) - 9.0;
+        }
+    }
+    return matrix;
+}
+
+// makes a list of count cells of an m * n Matrix, of small integers at
+// pseudo-random positions, some of which may be the same
+static std::vector<SparseEntry<double>> make_entries(std::size_t m, std::size_t n, std::size_t count, std::uint32_t seed) {
+    std::vector<SparseEntry<double>> entries(count);
+    for (auto& entry : entries) {
+        seed = seed * 1664525u + 1013904223u;
+        entry.row = (seed >> 4) % m;
+        seed = seed * 1664525u + 1013904223u;
+        entry.col = (seed >> 4) % n;
+        entry.value = static_cast<double>((seed >> 16) % 19) - 9.0;
+    }
+    return entries;
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "Building sparse matrices", "",
+    ((SparseFormat F), F), SparseFormat::ROW, SparseFormat::COLUMN
+) {
+    GIVEN("A dense Matrix with mostly zero cells") {
+        Matrix<double> dense = make_sparse(7, 5, 1, 3);
+        WHEN("A SparseMatrix is made from it") {
+            SparseMatrix<double, F> sparse(dense);
+            THEN("It has the same dimensions and cells") {
+                CHECK(sparse.row_count() == 7);
+                CHECK(sparse.col_count() == 5);
+                for (std::size_t m = 0; m < 7; m++) {
+                    for (std::size_t n = 0; n < 5; n++) {
+                        CHECK(sparse(m, n) == dense(m, n));
+                        CHECK(sparse.at(m, n) == dense(m, n));
+                    }
+                }
+                CHECK(sparse.to_dense() == dense);
+            }
+            THEN("Only the non-zero cells are stored") {
+                std::size_t non_zero = 0;
+                for (double cell : dense.contents()) {
+                    non_zero += cell != 0.0 ? 1 : 0;
+                }
+                CHECK(sparse.non_zero_count() == non_zero);
+                CHECK(sparse.values().size() == non_zero);
+                CHECK(sparse.indices().size() == non_zero);
+                CHECK(sparse.offsets().size() == (F == SparseFormat::ROW ? 8 : 6));
+            }
+            THEN("Accessing cells out of bounds throws an exception") {
+                CHECK_THROWS_AS(sparse.at(7, 0), std::runtime_error);
+                CHECK_THROWS_AS(sparse.at(0, 5), std::runtime_error);
+            }
+        }
+    }
+    GIVEN("A list of cells, some of them given more than once") {
+        std::vector<SparseEntry<int>> entries = {
+            {2, 1, 5,}, {0, 3, 1,}, {2, 1, 2,}, {1, 0, -4,}, {0, 0, 3,},
+        };
+        WHEN("A SparseMatrix is made from it") {
+            SparseMatrix<int, F> sparse(3, 4, entries);
+            THEN("The values of duplicate cells are summed") {
+                CHECK(sparse.non_zero_count() == 4);
+                Matrix<int> expected(3, 4, {{3, 0, 0, 1,}, {-4, 0, 0, 0,}, {0, 7, 0, 0,},});
+                CHECK(sparse.to_dense() == expected);
+            }
+        }
+        THEN("Cells out of bounds are rejected") {
+            entries.push_back({3, 0, 1,});
+            CHECK_THROWS_AS((SparseMatrix<int, F>(3, 4, entries)), std::runtime_error);
+        }
+    }
+}
+
+SCENARIO("Building sparse matrices from compressed arrays") {
+    GIVEN("Valid CSR arrays") {
+        CsrMatrix<int> sparse(2, 3, {0, 2, 3,}, {0, 2, 1,}, {1, 2, 3,});
+        THEN("The SparseMatrix has those cells") {
+            CHECK(sparse.to_dense() == Matrix<int>(2, 3, {{1, 0, 2,}, {0, 3, 0,},}));
+        }
+    }
+    GIVEN("Inconsistent CSR arrays") {
+        THEN("Building a SparseMatrix from them throws an exception") {
+            // too few offsets
+            CHECK_THROWS_AS(CsrMatrix<int>(2, 3, {0, 2,}, {0, 2,}, {1, 2,}), std::runtime_error);
+            // index out of bounds
+            CHECK_THROWS_AS(CsrMatrix<int>(2, 3, {0, 1, 1,}, {3,}, {1,}), std::runtime_error);
+            // indices not ascending
+            CHECK_THROWS_AS(CsrMatrix<int>(2, 3, {0, 2, 2,}, {2, 0,}, {1, 2,}), std::runtime_error);
+            // not as many values as indices
+            CHECK_THROWS_AS(CsrMatrix<int>(2, 3, {0, 1, 1,}, {0,}, {1, 2,}), std::runtime_error);
+        }
+    }
+}
+
+SCENARIO("Converting between sparse formats and transposing") {
+    GIVEN("A CSR Matrix") {
+        Matrix<double> dense = make_sparse(9, 4, 2, 3);
+        CsrMatrix<double> csr(dense);
+        WHEN("It is converted to CSC") {
+            CscMatrix<double> csc(csr);
+            THEN("It has the same cells") {
+                CHECK(csc.to_dense() == dense);
+                CHECK(csc == CscMatrix<double>(dense));
+                CHECK(CsrMatrix<double>(csc) == csr);
+            }
+        }
+        THEN("Its transpose is that of the dense Matrix") {
+            CHECK(csr.transpose().to_dense() == dense.transpose());
+            CHECK(CscMatrix<double>(dense).transpose().to_dense() == dense.transpose());
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "Arithmetic on sparse matrices", "",
+    ((SparseFormat F), F), SparseFormat::ROW, SparseFormat::COLUMN
+) {
+    GIVEN("Sparse matrices and the same dense ones") {
+        Matrix<double> a = make_sparse(6, 8, 3, 4);
+        Matrix<double> b = make_sparse(6, 8, 4, 4);
+        Matrix<double> c = make_sparse(8, 5, 5, 3);
+        SparseMatrix<double, F> x(a);
+        SparseMatrix<double, F> y(b);
+        SparseMatrix<double, F> z(c);
+        THEN("Adding, subtracting and scaling them gives the same as for the dense ones") {
+            CHECK((x + y).to_dense() == Matrix<double>(a + b));
+            CHECK((x - y).to_dense() == Matrix<double>(a - b));
+            CHECK((x * 3.0).to_dense() == Matrix<double>(a * 3.0));
+            CHECK((3.0 * x).to_dense() == Matrix<double>(a * 3.0));
+        }
+        THEN("Multiplying them gives the same as for the dense ones") {
+            CHECK((x * z).to_dense() == a * c);
+            CHECK(x * c == a * c);
+        }
+        THEN("Multiplying by a vector gives the same as for the dense ones") {
+            std::vector<double> vector = {1.0, -2.0, 3.0, 0.0, 5.0, -1.0, 2.0, 4.0,};
+            Matrix<double> column(8, 1, vector);
+            std::vector<double> product = x * vector;
+            Matrix<double> expected = a * column;
+            REQUIRE(product.size() == 6);
+            for (std::size_t i = 0; i < 6; i++) {
+                CHECK(product[i] == expected(i, 0));
+            }
+        }
+        THEN("Arithmetic on matrices of incompatible dimensions throws an exception") {
+            CHECK_THROWS_AS(x + z, std::runtime_error);
+            CHECK_THROWS_AS(x * y, std::runtime_error);
+            CHECK_THROWS_AS(x * b, std::runtime_error);
+            CHECK_THROWS_AS(x * std::vector<double>(6), std::runtime_error);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "Arithmetic on large sparse matrices in parallel", "",
+    ((SparseFormat F), F), SparseFormat::ROW, SparseFormat::COLUMN
+) {
+    GIVEN("Large sparse matrices and a ThreadPool") {
+        ThreadPool pool(3);
+        // enough rows and cells for the work to be shared between tasks
+        SparseMatrix<double, F> a(4000, 3000, make_entries(4000, 3000, 24000, 6));
+        SparseMatrix<double, F> b(3000, 3500, make_entries(3000, 3500, 21000, 7));
+        SparseMatrix<double, F> c(4000, 3000, make_entries(4000, 3000, 24000, 8));
+        THEN("Multiplying by a vector in parallel is the same as sequentially") {
+            std::vector<double> vector(3000);
+            for (std::size_t i = 0; i < 3000; i++) {
+                vector[i] = static_cast<double>(i % 7) - 3.0;
+            }
+            CHECK(multiply(execution::par.on(pool), a, vector) == multiply(execution::seq, a, vector));
+        }
+        THEN("Multiplying by a dense Matrix in parallel is the same as sequentially") {
+            Matrix<double> dense = make_sparse(3000, 200, 9, 2);
+            CHECK(multiply(execution::par.on(pool), a, dense) == multiply(execution::seq, a, dense));
+            Matrix<double> narrow = make_sparse(3000, 3, 10, 2);
+            CHECK(multiply(execution::par.on(pool), a, narrow) == multiply(execution::seq, a, narrow));
+        }
+        THEN("Multiplying by a dense Matrix with no columns in parallel gives an empty product") {
+            Matrix<double> empty(3000, 0);
+            Matrix<double> product = multiply(execution::par.on(pool), a, empty);
+            CHECK(product.row_count() == 4000);
+            CHECK(product.col_count() == 0);
+        }
+        THEN("Multiplying and adding them in parallel is the same as sequentially") {
+            CHECK(multiply(execution::par.on(pool), a, b) == multiply(execution::seq, a, b));
+        }
+        THEN("Adding them with the default policy set to parallel is the same as sequentially") {
+            SparseMatrix<double, F> sum = a + c;
+            execution::set_default_policy(execution::par.on(pool));
+            CHECK(a + c == sum);
+            execution::set_default_policy(execution::seq);
+        }
+    }
+}
@@ -0,0 +1,232 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Execution.hpp>
+#include <gryde/Matrix.hpp>
+#include <gryde/SparseMatrix.hpp>
+#include <gryde/TextFile.hpp>
+#include <gryde/ThreadPool.hpp>
+
+#include "helpers.hpp"
+
+
+using namespace com::saxbophone::gryde;
+using namespace com::saxbophone::gryde::tests;
+
+static void write_text(const std::filesystem::path& path, const std::string& text) {
+    std::ofstream(path, std::ios::binary) << text;
+}
+
+static std::string read_text(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// makes a dynamic Matrix with a predictable, non-uniform pattern of
+// fractional contents
+static Matrix<double> make_fractional(std::size_t m, std::size_t n) {
+    Matrix<double> matrix(m, n);
+    auto cells = matrix.contents();
+    for (std::size_t i = 0; i < cells.size(); i++) {
+        cells[i] = static_cast<double>(i % 97) / 7.0 - 3.0;
+    }
+    return matrix;
+}
+
+TEST_CASE("Text is split into chunks of whole lines") {
+    ThreadPool pool(3);
+    std::string text;
+    for (int i = 0; i < 1000; i++) {
+        text += std::to_string(i) + (i % 10 == 0 ? "\n \n" : "\n");
+    }
+    // chunks of at least 100 bytes, so that there are plenty of them
+    detail::TextChunks split = detail::split_lines(&pool, text, 100);
+    CHECK(split.chunks.size() > 1);
+    CHECK(split.line_count == 1000);
+    std::vector<int> lines(1000, -1);
+    detail::for_each_line(&pool, split, [&](std::size_t index, std::string_view line) {
+        lines[index] = std::stoi(std::string(line));
+    });
+    for (int i = 0; i < 1000; i++) {
+        CHECK(lines[static_cast<std::size_t>(i)] == i);
+    }
+}
+
+SCENARIO("Loading and saving CSV files") {
+    GIVEN("A Matrix saved as CSV") {
+        TemporaryFile file("matrix.csv");
+        Matrix<double> matrix = make_fractional(300, 200);
+        matrix(0, 0) = 0.1;
+        matrix(1, 1) = 1e300;
+        matrix(2, 2) = -2.5e-300;
+        save_csv(execution::par, file.path(), matrix);
+        THEN("Loading it gives the same Matrix, sequentially or in parallel") {
+            CHECK(load_csv<double>(execution::seq, file.path()) == matrix);
+            CHECK(load_csv<double>(execution::par, file.path()) == matrix);
+        }
+        THEN("Loading it as column-major gives the same cells") {
+            CHECK(load_csv<double, Layout::COLUMN_MAJOR>(execution::par, file.path()) == matrix);
+        }
+    }
+    GIVEN("A column-major Matrix saved as CSV with another delimiter") {
+        TemporaryFile file("column.csv");
+        ColumnMajorMatrix<int> matrix(2, 3, {{1, 2, 3}, {4, 5, 6}});
+        save_csv(execution::seq, file.path(), matrix, ';');
+        THEN("It's written row by row") {
+            CHECK(read_text(file.path()) == "1;2;3\n4;5;6\n");
+            CHECK(load_csv<int>(execution::seq, file.path(), ';') == matrix);
+        }
+    }
+    GIVEN("A CSV file with whitespace, signs, blank lines and CRLF line endings") {
+        TemporaryFile file("untidy.csv");
+        write_text(file.path(), "\r\n 1, +2 ,-3\r\n\r\n4.5,\t5e1,6\r\n  \n");
+        THEN("It's read as a Matrix with a row for each non-blank line") {
+            CHECK(load_csv<float>(execution::seq, file.path()) == Matrix<float>(2, 3, {{1, 2, -3}, {4.5f, 50, 6}}));
+        }
+    }
+    GIVEN("An empty CSV file") {
+        TemporaryFile file("empty.csv");
+        write_text(file.path(), "");
+        THEN("It's read as an empty Matrix") {
+            CHECK(load_csv<int>(execution::seq, file.path()).dimensions() == std::pair<std::size_t, std::size_t>(0, 0));
+        }
+    }
+    GIVEN("CSV files which can't be read") {
+        TemporaryFile file("invalid.csv");
+        THEN("Rows with too few or too many values throw an exception") {
+            write_text(file.path(), "1,2,3\n4,5\n");
+            CHECK_THROWS_AS(load_csv<int>(execution::seq, file.path()), std::runtime_error);
+            write_text(file.path(), "1,2\n3,4,5\n");
+            CHECK_THROWS_AS(load_csv<int>(execution::seq, file.path()), std::runtime_error);
+        }
+        THEN("Values which aren't numbers of the element type throw an exception") {
+            write_text(file.path(), "1,2\n3,x\n");
+            CHECK_THROWS_AS(load_csv<int>(execution::par, file.path()), std::runtime_error);
+            write_text(file.path(), "1,2.5\n");
+            CHECK_THROWS_AS(load_csv<int>(execution::seq, file.path()), std::runtime_error);
+            write_text(file.path(), "1,,3\n");
+            CHECK_THROWS_AS(load_csv<int>(execution::seq, file.path()), std::runtime_error);
+        }
+    }
+}
+
+SCENARIO("Loading and saving Matrix Market files") {
+    GIVEN("A Matrix saved in array format") {
+        TemporaryFile file("array.mtx");
+        Matrix<double> matrix = make_fractional(300, 200);
+        save_matrix_market(execution::par, file.path(), matrix);
+        THEN("Loading it gives the same Matrix") {
+            CHECK(load_matrix_market<double>(execution::par, file.path()) == matrix);
+            CHECK(load_matrix_market<double, Layout::COLUMN_MAJOR>(execution::seq, file.path()) == matrix);
+        }
+        THEN("Loading it as a SparseMatrix gives the same cells") {
+            CHECK(load_sparse_matrix_market<double>(execution::par, file.path()).to_dense() == matrix);
+        }
+    }
+    GIVEN("A small Matrix saved in array format") {
+        TemporaryFile file("small.mtx");
+        save_matrix_market(execution::seq, file.path(), Matrix<int>(2, 2, {{1, 2}, {3, 4}}));
+        THEN("Its cells are listed column by column") {
+            CHECK(read_text(file.path()) == "%%MatrixMarket matrix array integer general\n2 2\n1\n3\n2\n4\n");
+        }
+    }
+    GIVEN("A SparseMatrix saved in coordinate format") {
+        TemporaryFile file("coordinate.mtx");
+        SparseMatrix<double, SparseFormat::COLUMN> sparse(
+            Matrix<double>(4, 3, {{0, 1.5, 0}, {-2, 0, 0}, {0, 0, 3}, {0, 4, 0}})
+        );
+        save_matrix_market(execution::seq, file.path(), sparse);
+        THEN("Its cells are listed with indices from one") {
+            CHECK(read_text(file.path()) == "%%MatrixMarket matrix coordinate real general\n4 3 4\n2 1 -2\n1 2 1.5\n4 2 4\n3 3 3\n");
+        }
+        THEN("Loading it gives the same Matrix, dense or sparse") {
+            CHECK(load_matrix_market<double>(execution::seq, file.path()) == sparse.to_dense());
+            auto loaded = load_sparse_matrix_market<double, SparseFormat::COLUMN>(execution::par, file.path());
+            CHECK(loaded.offsets().size() == 4);
+            CHECK(loaded.to_dense() == sparse.to_dense());
+        }
+    }
+    GIVEN("A large Matrix with some zero cells saved in array format") {
+        TemporaryFile file("zeros.mtx");
+        Matrix<long long> matrix = make_patterned(1000, 700, 5);
+        save_matrix_market(execution::seq, file.path(), matrix);
+        THEN("Loading it as a SparseMatrix keeps only the non-zero cells") {
+            auto rows = load_sparse_matrix_market<long long>(execution::par, file.path());
+            auto cols = load_sparse_matrix_market<long long, SparseFormat::COLUMN>(execution::par, file.path());
+            CHECK(rows == SparseMatrix<long long>(matrix));
+            CHECK(cols == SparseMatrix<long long, SparseFormat::COLUMN>(matrix));
+        }
+    }
+    GIVEN("A large coordinate file listing cells out of order and more than once") {
+        TemporaryFile file("duplicates.mtx");
+        std::vector<SparseEntry<int>> entries;
+        std::string text = "%%MatrixMarket matrix coordinate integer general\n900 800 200000\n";
+        for (std::size_t c = 0; c < 200000; c++) {
+            entries.push_back({c * 7919 % 900, c * 104729 % 800, static_cast<int>(c % 13) - 6});
+            text += std::to_string(entries.back().row + 1) + " " + std::to_string(entries.back().col + 1) + " ";
+            text += std::to_string(entries.back().value) + "\n";
+        }
+        write_text(file.path(), text);
+        THEN("Loading it sums the values of each cell") {
+            CHECK(
+                load_sparse_matrix_market<int>(execution::par, file.path()) ==
+                SparseMatrix<int>(900, 800, entries)
+            );
+            CHECK(
+                load_sparse_matrix_market<int, SparseFormat::COLUMN>(execution::par, file.path()) ==
+                SparseMatrix<int, SparseFormat::COLUMN>(900, 800, entries)
+            );
+        }
+    }
+    GIVEN("Symmetric, skew-symmetric and pattern files with comments") {
+        TemporaryFile symmetric("symmetric.mtx");
+        TemporaryFile skew("skew.mtx");
+        TemporaryFile pattern("pattern.mtx");
+        write_text(symmetric.path(), "%%MatrixMarket matrix coordinate integer symmetric\n% a comment\n%\n3 3 3\n1 1 5\n3 1 -1\n3 2 +2\n");
+        write_text(skew.path(), "%%MatrixMarket MATRIX Coordinate Real Skew-Symmetric\n2 2 1\n2 1 0.5\n");
+        write_text(pattern.path(), "%%MatrixMarket matrix coordinate pattern general\n2 3 2\n1 3\n2 1\n");
+        THEN("The mirrored cells are filled in") {
+            Matrix<int> expected(3, 3, {{5, 0, -1}, {0, 0, 2}, {-1, 2, 0}});
+            CHECK(load_matrix_market<int>(execution::seq, symmetric.path()) == expected);
+            auto sparse = load_sparse_matrix_market<int>(execution::seq, symmetric.path());
+            CHECK(sparse.non_zero_count() == 5);
+            CHECK(sparse.to_dense() == expected);
+            CHECK(load_matrix_market<double>(execution::seq, skew.path()) == Matrix<double>(2, 2, {{0, -0.5}, {0.5, 0}}));
+        }
+        THEN("Listed cells of a pattern are one") {
+            CHECK(load_matrix_market<int>(execution::seq, pattern.path()) == Matrix<int>(2, 3, {{0, 0, 1}, {1, 0, 0}}));
+        }
+    }
+    GIVEN("Matrix Market files which can't be read") {
+        TemporaryFile file("invalid.mtx");
+        THEN("A file without a banner throws an exception") {
+            write_text(file.path(), "2 2 1\n1 1 1\n");
+            CHECK_THROWS_AS(load_matrix_market<int>(execution::seq, file.path()), std::runtime_error);
+        }
+        THEN("A file of complex values throws an exception") {
+            write_text(file.path(), "%%MatrixMarket matrix coordinate complex general\n1 1 1\n1 1 1 0\n");
+            CHECK_THROWS_AS(load_matrix_market<double>(execution::seq, file.path()), std::runtime_error);
+        }
+        THEN("A file with the wrong number of entries throws an exception") {
+            write_text(file.path(), "%%MatrixMarket matrix coordinate real general\n2 2 3\n1 1 1\n2 2 1\n");
+            CHECK_THROWS_AS(load_matrix_market<double>(execution::seq, file.path()), std::runtime_error);
+            CHECK_THROWS_AS(load_sparse_matrix_market<double>(execution::seq, file.path()), std::runtime_error);
+        }
+        THEN("A file with entries out of bounds throws an exception") {
+            write_text(file.path(), "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n");
+            CHECK_THROWS_AS(load_matrix_market<double>(execution::seq, file.path()), std::runtime_error);
+            write_text(file.path(), "%%MatrixMarket matrix coordinate real general\n2 2 1\n0 1 1\n");
+            CHECK_THROWS_AS(load_sparse_matrix_market<double>(execution::seq, file.path()), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,211 @@
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <gryde/Matrix.hpp>
+#include <gryde/MatrixView.hpp>
+
+
+using namespace com::saxbophone::gryde;
+
+// collects the cells of a view into a vector, in row-major order
+template <typename T>
+static std::vector<T> collect(const MatrixView<const T>& view) {
+    std::vector<T> cells;
+    for (std::size_t m = 0; m < view.row_count(); m++) {
+        for (std::size_t n = 0; n < view.col_count(); n++) {
+            cells.push_back(view(m, n));
+        }
+    }
+    return cells;
+}
+
+SCENARIO("Viewing a fixed-size Matrix") {
+    GIVEN("A fixed-size Matrix with some contents") {
+        Matrix<int, 3, 4> matrix = {
+            {1, 2, 3, 4,},
+            {5, 6, 7, 8,},
+            {9, 10, 11, 12,},
+        };
+        WHEN("A view of the whole Matrix is made") {
+            MatrixView<const int> view = matrix.view();
+            THEN("The view has the same dimensions and cells as the Matrix") {
+                REQUIRE(view.dimensions() == matrix.dimensions());
+                auto cells = matrix.contents();
+                CHECK(collect(view) == std::vector<int>(cells.begin(), cells.end()));
+            }
+            THEN("Accessing cells out of bounds with at() throws an exception") {
+                CHECK_THROWS(view.at(3, 0));
+                CHECK_THROWS(view.at(0, 4));
+            }
+        }
+        WHEN("A cell is written through a read-write view") {
+            matrix.view().block(1, 1, 2, 2)(1, 0) = 42;
+            THEN("The cell of the Matrix is changed") {
+                CHECK(matrix(2, 1) == 42);
+            }
+        }
+        WHEN("A block of the Matrix is viewed") {
+            MatrixView<const int> block = matrix.view().block(1, 1, 2, 3);
+            THEN("The view refers to the cells of the block") {
+                REQUIRE(block.row_count() == 2);
+                REQUIRE(block.col_count() == 3);
+                CHECK(collect(block) == std::vector<int>{6, 7, 8, 10, 11, 12});
+            }
+        }
+        THEN("Viewing a block which isn't inside the Matrix throws an exception") {
+            CHECK_THROWS(matrix.view().block(2, 0, 2, 1));
+            CHECK_THROWS(matrix.view().block(0, 3, 1, 2));
+        }
+        WHEN("The transposition of the Matrix is viewed") {
+            MatrixView<const int> transposed = matrix.view().transpose();
+            THEN("The rows of the view are the columns of the Matrix") {
+                REQUIRE(transposed.row_count() == 4);
+                REQUIRE(transposed.col_count() == 3);
+                CHECK(collect(transposed) == std::vector<int>{1, 5, 9, 2, 6, 10, 3, 7, 11, 4, 8, 12});
+            }
+        }
+        WHEN("The Matrix is viewed without a row and column in its interior") {
+            MatrixView<const int> sub = matrix.view().submatrix(1, 2);
+            THEN("The view steps over the removed row and column") {
+                REQUIRE(sub.row_count() == 2);
+                REQUIRE(sub.col_count() == 3);
+                CHECK(collect(sub) == std::vector<int>{1, 2, 4, 9, 10, 12});
+            }
+            THEN("The view can be transposed and made into blocks") {
+                CHECK(collect(sub.transpose()) == std::vector<int>{1, 9, 2, 10, 4, 12});
+                CHECK(collect(sub.block(0, 1, 2, 2)) == std::vector<int>{2, 4, 10, 12});
+                CHECK(collect(sub.block(1, 2, 1, 1)) == std::vector<int>{12});
+            }
+            THEN("Removing another interior row or column from the view throws an exception") {
+                CHECK_THROWS(matrix.view().remove_col(1).remove_col(1));
+            }
+            THEN("Removing the first or last row or column from the view still works") {
+                CHECK(collect(sub.remove_row(0)) == std::vector<int>{9, 10, 12});
+                CHECK(collect(sub.remove_col(2)) == std::vector<int>{1, 2, 9, 10});
+            }
+        }
+    }
+}
+
+SCENARIO("Viewing a dynamic-size Matrix") {
+    GIVEN("A large dynamic-size Matrix") {
+        Matrix<int> matrix(1000, 1000);
+        auto cells = matrix.contents();
+        for (std::size_t i = 0; i < cells.size(); i++) {
+            cells[i] = static_cast<int>(i);
+        }
+        WHEN("A block of it is viewed") {
+            MatrixView<const int> block = std::as_const(matrix).view().block(500, 250, 3, 2);
+            THEN("The view refers to the cells of the Matrix in place") {
+                CHECK(&block(0, 0) == &matrix(500, 250));
+                CHECK(collect(block) == std::vector<int>{500250, 500251, 501250, 501251, 502250, 502251});
+            }
+        }
+        THEN("Removing an out of bounds row or column from a view throws an exception") {
+            CHECK_THROWS(matrix.view().remove_row(1000));
+            CHECK_THROWS(matrix.view().remove_col(1000));
+        }
+    }
+}
+
+SCENARIO("Making new matrices from views") {
+    GIVEN("A dynamic-size Matrix with some contents") {
+        Matrix<int> matrix(
+            3, 2,
+            {
+                {1, 2,},
+                {3, 4,},
+                {5, 6,},
+            }
+        );
+        THEN("A Matrix can be constructed from a view of it") {
+            Matrix<int, 2, 3> transposed = matrix.view().transpose();
+            Matrix<int, 2, 3> expected = {
+                {1, 3, 5,},
+                {2, 4, 6,},
+            };
+            CHECK(transposed == expected);
+        }
+        THEN("Constructing a fixed-size Matrix from a view of the wrong size throws an exception") {
+            CHECK_THROWS(Matrix<int, 3, 2>(matrix.view().transpose()));
+        }
+        THEN("Matrix.transpose() makes a transposed copy") {
+            Matrix<int> expected(2, 3, {{1, 3, 5,}, {2, 4, 6,},});
+            CHECK(matrix.transpose() == expected);
+        }
+        THEN("Matrix.remove_row() makes a copy without that row") {
+            Matrix<int> expected(2, 2, {{1, 2,}, {5, 6,},});
+            CHECK(matrix.remove_row(1) == expected);
+        }
+        THEN("Matrix.remove_col() makes a copy without that column") {
+            Matrix<int> expected(3, 1, {{2,}, {4,}, {6,},});
+            CHECK(matrix.remove_col(0) == expected);
+        }
+    }
+    GIVEN("A fixed-size Matrix with some contents") {
+        Matrix<int, 3, 3> matrix = {
+            {1, 2, 3,},
+            {4, 5, 6,},
+            {7, 8, 9,},
+        };
+        THEN("Matrix.remove_row() makes a copy without that row") {
+            Matrix<int, 2, 3> expected = {{1, 2, 3,}, {7, 8, 9,},};
+            CHECK(matrix.remove_row(1) == expected);
+            CHECK_THROWS(matrix.remove_row(3));
+        }
+        THEN("Matrix.remove_col() makes a copy without that column") {
+            Matrix<int, 3, 2> expected = {{1, 2,}, {4, 5,}, {7, 8,},};
+            CHECK(matrix.remove_col(2) == expected);
+            CHECK_THROWS(matrix.remove_col(3));
+        }
+    }
+}
+
+SCENARIO("Arithmetic with views") {
+    GIVEN("A fixed-size Matrix and a dynamic-size Matrix with some contents") {
+        Matrix<int, 2, 3> a = {
+            {1, 2, 3,},
+            {4, 5, 6,},
+        };
+        Matrix<int> b(
+            3, 2,
+            {
+                {7, 8,},
+                {9, 10,},
+                {11, 12,},
+            }
+        );
+        THEN("Views can be added to, subtracted from and scaled like matrices") {
+            Matrix<int, 2, 3> sum = a + b.view().transpose();
+            Matrix<int, 2, 3> expected_sum = {
+                {8, 11, 14,},
+                {12, 15, 18,},
+            };
+            CHECK(sum == expected_sum);
+            Matrix<int> difference = b.view().transpose() * 2 - a;
+            Matrix<int> expected_difference(
+                2, 3,
+                {
+                    {13, 16, 19,},
+                    {12, 15, 18,},
+                }
+            );
+            CHECK(difference == expected_difference);
+        }
+        THEN("Views can be multiplied with matrices and other views") {
+            Matrix<int> product(2, 2, {{58, 64,}, {139, 154,},});
+            CHECK(a.view() * b == product);
+            CHECK(a * b.view() == product);
+            CHECK(a.view() * b.view() == product);
+            // (A * B)^T == B^T * A^T
+            CHECK(b.view().transpose() * a.view().transpose() == product.transpose());
+        }
+        THEN("Multiplying views with incompatible dimensions throws an exception") {
+            CHECK_THROWS(a.view() * a.view());
+        }
+    }
+}